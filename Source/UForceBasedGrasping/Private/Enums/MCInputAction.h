@@ -0,0 +1,20 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+#include "ObjectMacros.h"
+
+/*
+ * The input actions of the motion controller character that can be recorded and replayed
+ */
+UENUM(BlueprintType)
+enum class EMCInputAction : uint8
+{
+	SwitchGraspType			UMETA(DisplayName = "SwitchGraspType"),
+	NextGraspType			UMETA(DisplayName = "NextGraspType"),
+	PreviousGraspType		UMETA(DisplayName = "PreviousGraspType"),
+	SwitchGraspProcess		UMETA(DisplayName = "SwitchGraspProcess"),
+	LeftFixationGrasp		UMETA(DisplayName = "LeftFixationGrasp"),
+	RightFixationGrasp		UMETA(DisplayName = "RightFixationGrasp"),
+	LeftGraspDetach			UMETA(DisplayName = "LeftGraspDetach"),
+	RightGraspDetach		UMETA(DisplayName = "RightGraspDetach"),
+};
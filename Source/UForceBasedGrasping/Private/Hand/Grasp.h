@@ -1,117 +1,211 @@
-// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
-
-#pragma once
-
-#include "Enums/GraspType.h"
-#include "Utilities/HandInformationParser.h"
-#include "Structs/Finger.h"
-#include "Structs/HandOrientation.h"
-#include "Structs/HandVelocity.h"
-#include "Utilities/GraspingGame.h"
-
-class AHand;
-
-/** Enum indicating the grasp status */
-UENUM(BlueprintType)
-enum class EGraspStatus : uint8
-{
-	Started		UMETA(DisplayName = "Started"),
-	Orientation	UMETA(DisplayName = "Orientation"),
-	Velocity	UMETA(DisplayName = "Velocity"),
-	Stopped		UMETA(DisplayName = "Stopped"),
-};
-
-/** Enum indicating the comparison type */
-UENUM(BlueprintType)
-enum class EComparison : uint8
-{
-	Bigger	UMETA(DisplayName = "Bigger"),
-	Smaller	UMETA(DisplayName = "Smaller"),
-	Equals	UMETA(DisplayName = "Equals"),
-};
-
-/**
- * This class deals with the grasping of a hand
- */
-class UFORCEBASEDGRASPING_API Grasp
-{
-public:
-	// Constructor
-	Grasp();
-
-	// Destructor
-	~Grasp();
-
-	// Updates the Grasp Orientation of the gven Hand
-	void UpdateGrasp(const float Alpha, const float VelocityThreshold, AHand * const Hand);
-
-	// Switches the Grasping Type
-	void SwitchGraspType(const AHand * const Hand, EGraspType GraspType);
-
-	// Switches the Grasping Type
-	void SwitchToPreviousGraspType(const AHand * const Hand, FText & GraspTypeName);
-
-	// Switches the Grasping Type
-	void SwitchToNextGraspType(const AHand * const Hand, FText & GraspTypeName);
-
-	// Switches the Grasping Process
-	void SwitchGraspProcess(AHand * const Hand, const float InSpring, const float InDamping, const float ForceLimit);
-
-	// Print The Fore 
-	void PrintHandInfo(const AHand * const Hand) const;
-	
-	// The current status of the grasp process
-	EGraspStatus GraspStatus;
-
-	// The Current Grasp type
-	EGraspType CurrentGraspType;
-
-private:
-	// The initial HandOrientation
-	FHandOrientation InitialHandOrientation;
-
-	// The closed HandOrientation
-	FHandOrientation ClosedHandOrientation;
-
-	// The HandVelocity after grasping
-	FHandVelocity HandVelocity;
-
-	// The HandOrientation of the last Tick
-	FHandOrientation LastHandOrientation;
-
-	// Current Grasp Process
-	TEnumAsByte<EAngularDriveMode::Type> CurrentAngularDriveMode;
-
-	// Parser of the ini files
-	TSharedPtr<HandInformationParser> HandInformationParserPtr;
-
-	// Linear Interpolation between the given InitialHandOrientation and the given ClosedHandOrientation from 0-1
-	void LerpHandOrientation(FHandOrientation & TargetHandOrientation, const FHandOrientation & InitialHandOrientation, const FHandOrientation & ClosedHandOrientation, const float Alpha);
-	
-	// Linear Interpolation between the given InitialFingerOrientation and the given ClosedFingerOrientation from 0-1
-	void LerpFingerOrientation(FFingerOrientation & TargetFingerOrientation, const FFingerOrientation & InitialFingerOrientation, const FFingerOrientation & ClosedFingerOrientation, const float Alpha);
-
-	// Moves the given Hand to the given HandOrientation
-	void DriveToHandOrientationTarget(const FHandOrientation & HandOrientation, const AHand* const Hand);
-	
-	// Moves the given Finger to the given FingerOrientation
-	void DriveToFingerOrientationTarget(const FFingerOrientation & FingerOrientation, const FFinger & Finger);
-
-	// Moves the given Hand to the given HandOrientation
-	void DriveToHandVelocityTarget(const FHandVelocity & HandVelocity, const AHand * const Hand);
-	
-	// Moves the given Finger to the given FingerOrientation
-	void DriveToFingerVelocityTarget(const FFingerVelocity & FingerVelocity, const FFinger & Finger);
-
-	// Drives the given Hand to the InitialHandOrientation
-	void DriveToInitialOrientation(const AHand * const Hand);
-
-	// Checks the Distal Velocity to be higher,lower,equals the threshold
-	bool CheckDistalVelocity(const AHand* const Hand, const float VelocityThreshold, const EComparison Comparison);
-
-	// Locks the angular rotation of a Constraint
-	void LockConstraint(FConstraintInstance* Constraint);
-
-	//Unlocks the angular rotation of a constraint
-	void UnlockConstraint(FConstraintInstance* Constraint);
-};
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "Enums/GraspType.h"
+#include "Utilities/HandInformationParser.h"
+#include "Structs/Finger.h"
+#include "Structs/HandOrientation.h"
+#include "Structs/HandVelocity.h"
+#include "Utilities/GraspingGame.h"
+#include "Utilities/Mailbox.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+class AHand;
+
+/** Enum indicating the grasp status */
+UENUM(BlueprintType)
+enum class EGraspStatus : uint8
+{
+	Started		UMETA(DisplayName = "Started"),
+	Orientation	UMETA(DisplayName = "Orientation"),
+	Velocity	UMETA(DisplayName = "Velocity"),
+	Stopped		UMETA(DisplayName = "Stopped"),
+};
+
+/** Enum indicating the comparison type */
+UENUM(BlueprintType)
+enum class EComparison : uint8
+{
+	Bigger	UMETA(DisplayName = "Bigger"),
+	Smaller	UMETA(DisplayName = "Smaller"),
+	Equals	UMETA(DisplayName = "Equals"),
+};
+
+/**
+ * This class deals with the grasping of a hand
+ */
+class UFORCEBASEDGRASPING_API Grasp
+{
+public:
+	// Constructor
+	Grasp();
+
+	// Destructor
+	~Grasp();
+
+	// Updates the Grasp Orientation of the gven Hand
+	void UpdateGrasp(const float Alpha, const float VelocityThreshold, AHand * const Hand);
+
+	// Sets the grasp goal (0-1) for the fixed timestep controller, can be called from any rate (game thread)
+	void SetTargetAlpha(const float Alpha);
+
+
+	// Advances the fixed timestep controller and computes the finger targets, no physics access (safe to run in parallel for several hands)
+	void ComputeGraspTargets(const float DeltaTime);
+
+	// Drives the fingers to the targets of the last ComputeGraspTargets call (game thread)
+	void ApplyGraspTargets(AHand * const Hand);
+
+	// Advances the fixed timestep controller with the substep time and drives the fingers, only the constraint drives are written (physics substep)
+	void UpdateGraspSubstep(const float DeltaTime, AHand * const Hand);
+
+	// Takes over the grasp status of the substep controller (game thread)
+	void FetchSubstepGraspStatus();
+
+	// Drives the fingers to the targets of the controller again, e.g. after they were frozen (game thread)
+	void RestoreDriveTargets(const bool bOnSubsteps);
+
+	// Sets the fixed timestep controller parameters
+	void SetControllerParameters(const float InTimestep, const float InMaxAlphaRate);
+
+	// Switches the Grasping Type
+	void SwitchGraspType(const AHand * const Hand, EGraspType GraspType);
+
+	// Switches the Grasping Type
+	void SwitchToPreviousGraspType(const AHand * const Hand, FText & GraspTypeName);
+
+	// Switches the Grasping Type
+	void SwitchToNextGraspType(const AHand * const Hand, FText & GraspTypeName);
+
+	// Sets the axis the right hand pose tables are mirrored along, for hands with a left handed skeleton
+	void SetPoseMirrorAxis(const EAxis::Type InMirrorAxis);
+
+	// Switches the Grasping Process
+	void SwitchGraspProcess(AHand * const Hand, const float InSpring, const float InDamping, const float ForceLimit);
+
+	// Shows the joint forces on screen, only called for hands with bShowJointForces
+	void PrintHandInfo(const AHand * const Hand) const;
+
+	// Time the finger targets were last driven (FPlatformTime::Cycles64)
+	uint64 GetLastCommitCycles() const { return static_cast<uint64>(LastCommitCycles.GetValue()); }
+	
+	// The current status of the grasp process
+	EGraspStatus GraspStatus;
+
+	// The Current Grasp type
+	EGraspType CurrentGraspType;
+
+private:
+	// The initial HandOrientation
+	FHandOrientation InitialHandOrientation;
+
+	// The closed HandOrientation
+	FHandOrientation ClosedHandOrientation;
+
+	// The HandVelocity after grasping
+	FHandVelocity HandVelocity;
+
+	// The HandOrientation of the last Tick
+	FHandOrientation LastHandOrientation;
+
+	// Current Grasp Process
+	TEnumAsByte<EAngularDriveMode::Type> CurrentAngularDriveMode;
+
+	// Axis the pose tables of the ini files are mirrored along for this hand (EAxis::None = not mirrored)
+	EAxis::Type PoseMirrorAxis;
+
+	// Copy the finger targets of the current grasp type out of the shared pose tables
+	void LoadPoseTable();
+
+	// Latest grasp goal written by the input, read by the controller step
+	TMailbox<float> TargetAlphaMailbox;
+
+	// Grasp goal the controller is moving towards
+	float TargetAlpha;
+
+	// Rate limited grasp value currently driven to the fingers
+	float CurrentAlpha;
+
+	// Fixed timestep (s) of the grasp controller
+	float ControllerTimestep;
+
+	// Maximum change of the grasp value per second
+	float MaxAlphaRate;
+
+	// Time not yet consumed by the fixed timestep controller
+	float ControllerTimeAccumulator;
+
+	// Finger targets computed but not yet applied
+	FHandOrientation PendingHandOrientation;
+
+	// The pending finger targets should be applied
+	bool bPendingOrientation;
+
+	// The fingers should be released to the initial orientation
+	bool bPendingStop;
+
+	// Time the finger targets were last driven, written by the substep
+	FThreadSafeCounter64 LastCommitCycles;
+
+	// Poses of the current grasp type handed over to the physics substeps
+	struct FGraspPoses
+	{
+		// Open orientation of the fingers
+		FHandOrientation InitialHandOrientation;
+
+		// Closed orientation of the fingers
+		FHandOrientation ClosedHandOrientation;
+	};
+
+	// Latest poses posted by the game thread, read by the physics substep
+	TMailbox<FGraspPoses> PosesMailbox;
+
+	// Poses used by the substep controller
+	FGraspPoses SubstepPoses;
+
+	// Grasp value last driven by the substep controller
+	float SubstepDrivenAlpha;
+
+	// Grasp status of the substep controller
+	EGraspStatus SubstepGraspStatus;
+
+	// Grasp status posted by the substep controller, read by the game thread
+	TMailbox<EGraspStatus> SubstepGraspStatusMailbox;
+
+	// Advances the grasp value with the fixed timestep, returns true if the controller stepped
+	bool StepController(const float DeltaTime);
+
+	// Updates the grasp status and the pending finger targets for the grasp value
+	void ComputeGraspTarget(const float Alpha);
+
+	// Linear Interpolation between the given InitialHandOrientation and the given ClosedHandOrientation from 0-1
+	void LerpHandOrientation(FHandOrientation & TargetHandOrientation, const FHandOrientation & InitialHandOrientation, const FHandOrientation & ClosedHandOrientation, const float Alpha);
+	
+	// Linear Interpolation between the given InitialFingerOrientation and the given ClosedFingerOrientation from 0-1
+	void LerpFingerOrientation(FFingerOrientation & TargetFingerOrientation, const FFingerOrientation & InitialFingerOrientation, const FFingerOrientation & ClosedFingerOrientation, const float Alpha);
+
+	// Moves the given Hand to the given HandOrientation
+	void DriveToHandOrientationTarget(const FHandOrientation & HandOrientation, const AHand* const Hand);
+	
+	// Moves the given Finger to the given FingerOrientation
+	void DriveToFingerOrientationTarget(const FFingerOrientation & FingerOrientation, const FFinger & Finger);
+
+	// Moves the given Hand to the given HandOrientation
+	void DriveToHandVelocityTarget(const FHandVelocity & HandVelocity, const AHand * const Hand);
+	
+	// Moves the given Finger to the given FingerOrientation
+	void DriveToFingerVelocityTarget(const FFingerVelocity & FingerVelocity, const FFinger & Finger);
+
+	// Drives the given Hand to the InitialHandOrientation
+	void DriveToInitialOrientation(const AHand * const Hand);
+
+	// Checks the Distal Velocity to be higher,lower,equals the threshold
+	bool CheckDistalVelocity(const AHand* const Hand, const float VelocityThreshold, const EComparison Comparison);
+
+	// Locks the angular rotation of a Constraint
+	void LockConstraint(FConstraintInstance* Constraint);
+
+	//Unlocks the angular rotation of a constraint
+	void UnlockConstraint(FConstraintInstance* Constraint);
+};
@@ -8,6 +8,11 @@
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
 #include "Paths.h"
+#include "Utilities/HandProximityService.h"
+#include "Utilities/HandManager.h"
+#if WITH_PHYSX
+#include "PhysXPublic.h"
+#endif
 
 // Sets default values
 AHand::AHand()
@@ -18,21 +23,58 @@ AHand::AHand()
 	// Fixation grasp parameters	
 	bFixationGraspEnabled = true;
 	bTwoHandsFixationGraspEnabled = true;
-	bMovementMimickingHand = false;
+	bTwoHandsConstrained = false;
 	bGraspHeld = false;
 	bReadyForTwoHandsGrasp = false;
+	bUseProximityService = true;
+	bFixationGraspAreaEnabled = true;
+	bUseHandManager = true;
+
+	// Hybrid grasp default values
+	bHybridGraspEnabled = false;
+	HybridPromoteGripForce = 1000.f;
+	HybridMaxRelativeSpeed = 5.f;
+	HybridContactDistance = 1.5f;
+	HybridPromoteTime = 0.25f;
+	HybridDemoteGraspAlpha = 0.2f;
+	GraspInputAlpha = 0.f;
+	HybridCandidate = nullptr;
+	HybridCandidateRelativeSpeed = 0.f;
+	bHybridCandidateTouched = false;
+	HybridStableTime = 0.f;
+	bHybridGraspPromoted = false;
+	bHybridPromotePending = false;
+	bHybridDemotePending = false;
+	HybridObjectCollision = ECollisionEnabled::QueryAndPhysics;
 	OneHandFixationMaximumMass = 5.f;
 	OneHandFixationMaximumLength = 50.f;
 	TwoHandsFixationMaximumMass = 15.f;
 	TwoHandsFixationMaximumLength = 120.f;
+	MaxFixationGraspCandidates = 32;
+	PalmDirection = FVector(0.f, 0.f, 1.f);
+	CandidateDistanceWeight = 1.f;
+	CandidateAlignmentWeight = 0.5f;
+	CandidateSizeWeight = 0.25f;
 
 	// Set attachement collision component
 	FixationGraspArea = CreateDefaultSubobject<USphereComponent>(TEXT("FixationGraspArea"));
 	FixationGraspArea->SetupAttachment(GetRootComponent());
 	FixationGraspArea->InitSphereRadius(4.f);
 
+	// Set the constraint holding the hand at the object grasped by the other hand (two hands fixation grasp)
+	TwoHandsGraspConstraint = CreateDefaultSubobject<UPhysicsConstraintComponent>(TEXT("TwoHandsGraspConstraint"));
+	TwoHandsGraspConstraint->SetupAttachment(GetRootComponent());
+	TwoHandsGraspConstraint->SetLinearXLimit(ELinearConstraintMotion::LCM_Locked, 0.f);
+	TwoHandsGraspConstraint->SetLinearYLimit(ELinearConstraintMotion::LCM_Locked, 0.f);
+	TwoHandsGraspConstraint->SetLinearZLimit(ELinearConstraintMotion::LCM_Locked, 0.f);
+	TwoHandsGraspConstraint->SetAngularSwing1Limit(EAngularConstraintMotion::ACM_Locked, 0.f);
+	TwoHandsGraspConstraint->SetAngularSwing2Limit(EAngularConstraintMotion::ACM_Locked, 0.f);
+	TwoHandsGraspConstraint->SetAngularTwistLimit(EAngularConstraintMotion::ACM_Locked, 0.f);
+	TwoHandsGraspConstraint->ConstraintInstance.ProfileInstance.bDisableCollision = true;
+
 	// Set default as left hand
 	HandType = EHandType::Left;
+	PoseMirrorAxis = EAxis::X;
 
 	// Set skeletal mesh default physics related values
 	USkeletalMeshComponent* const SkelComp = GetSkeletalMeshComponent();
@@ -42,6 +84,7 @@ AHand::AHand()
 	SkelComp->bGenerateOverlapEvents = true;
 
 	bLogGrasp = true;
+	bShowJointForces = false;
 	// Angular drive default values
 	Spring = 9000.0f;
 	Damping = 1000.0f;
@@ -49,7 +92,44 @@ AHand::AHand()
 
 	VelocityThreshold = 1.0;
 
+	// Grasp controller default values
+	bFixedTimestepGrasp = true;
+	bGraspControlOnSubsteps = true;
+	GraspControlTimestep = 1.0f / 120.0f;
+	MaxGraspAlphaRate = 4.0f;
+
 	TickValue = 0.0f;
+	bShowJointForcesPending = false;
+
+	// Tracking default values (set by the owner of the hand)
+	TrackingRotationBoost = 0.0f;
+	TrackingPGain = 0.0f;
+	TrackingDGain = 0.0f;
+	TrackingMaxOutput = 0.0f;
+	TrackingBatchSlot = INDEX_NONE;
+	SubstepTrackingManager = nullptr;
+	TrackingLocationError = FVector::ZeroVector;
+	TrackingRotationError = FVector::ZeroVector;
+	TrackingTarget = FTransform::Identity;
+	bHasTrackingTarget = false;
+	bTrackingOnSubsteps = true;
+	bTrackRootBodyOnly = true;
+	TrackingForce = FVector::ZeroVector;
+	FingersMass = 0.0f;
+	TrackingMass = 0.0f;
+	BareHandMass = 0.0f;
+	bScheduleTrackingGains = true;
+	bRotationPDControl = false;
+	// Critically damped with a natural frequency of 20 rad/s
+	RotationPGain = 400.0f;
+	RotationDGain = 40.0f;
+	MaxAngularAcceleration = 5000.0f;
+	bGainScheduleDirty = true;
+	ScheduledMass = 0.0f;
+	TrackingGainBucket = INDEX_NONE;
+	TrackingAngularVelocity = FVector::ZeroVector;
+	SubstepTrackingTarget = FTransform::Identity;
+	RootBodyToComponent = FTransform::Identity;
 
 	// Set fingers and their bone names default values
 	AHand::SetupHandDefaultValues(HandType);
@@ -68,53 +148,532 @@ void AHand::BeginPlay()
 	// Disable tick as default
 	//SetActorTickEnabled(false);
 
-	// Bind overlap events
-	FixationGraspArea->OnComponentBeginOverlap.AddDynamic(this, &AHand::OnFixationGraspAreaBeginOverlap);
-	FixationGraspArea->OnComponentEndOverlap.AddDynamic(this, &AHand::OnFixationGraspAreaEndOverlap);
+	if (bUseProximityService)
+	{
+		// Objects in reach are reported by the service, the grasp area needs no collision
+		FixationGraspArea->bGenerateOverlapEvents = false;
+		FixationGraspArea->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		ProximityService = AHandProximityService::Get(GetWorld());
+		if (ProximityService.IsValid())
+		{
+			ProximityService->RegisterHand(this);
+		}
+	}
+	else
+	{
+		// Bind overlap events
+		FixationGraspArea->OnComponentBeginOverlap.AddDynamic(this, &AHand::OnFixationGraspAreaBeginOverlap);
+		FixationGraspArea->OnComponentEndOverlap.AddDynamic(this, &AHand::OnFixationGraspAreaEndOverlap);
+	}
 
 	// Setup the values for controlling the hand fingers
 	AHand::SetupAngularDriveValues(EAngularDriveMode::SLERP, EAngularDriveType::Orientation);
 	AHand::SetupBones();
+	AHand::SetupHandStateJointIndices();
+	AHand::SetupPoseMirroring();
+	AHand::UpdateHandState();
+
+	// Offset of the component to its root body, the substeps only see the body
+	FBodyInstance* const RootBody = GetSkeletalMeshComponent()->GetBodyInstance();
+	if (RootBody)
+	{
+		RootBodyToComponent = GetSkeletalMeshComponent()->GetComponentTransform().GetRelativeTransform(RootBody->GetUnrealWorldTransform());
+	}
+
+	// Mass of the fingers, the root body mass changes with the welded objects and is read every tick
+	FingersMass = 0.0f;
+	for (FBodyInstance* const Body : GetSkeletalMeshComponent()->Bodies)
+	{
+		if (Body && Body != RootBody)
+		{
+			FingersMass += Body->GetBodyMass();
+		}
+	}
+	BareHandMass = FingersMass + (RootBody ? RootBody->GetBodyMass() : 0.0f);
+	TrackingMass = BareHandMass;
+
+	// Run the grasp controller on the physics substeps
+	GraspPtr->SetControllerParameters(GraspControlTimestep, MaxGraspAlphaRate);
+	OnCalculateCustomPhysics.BindUObject(this, &AHand::SubstepTick);
+
+	// Let the manager update the hand together with the other hands
+	if (bUseHandManager)
+	{
+		HandManager = AHandManager::Get(GetWorld());
+		if (HandManager.IsValid())
+		{
+			HandManager->RegisterHand(this);
+		}
+	}
+	else if (GetOwner())
+	{
+		// Ticking on its own, update the hand after its owner has set the tracking target
+		AddTickPrerequisiteActor(GetOwner());
+	}
+}
 
+// Called when the actor is removed from the world
+void AHand::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ProximityService.IsValid())
+	{
+		ProximityService->UnregisterHand(this);
+	}
+	if (HandManager.IsValid())
+	{
+		HandManager->UnregisterHand(this);
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
-// Called every frame, used for motion control
+// Called every frame (only if the hand is not updated by the hand manager)
 void AHand::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	AHand::ReadPhysicsState();
+	AHand::ComputeControl(DeltaTime);
+	AHand::WritePhysicsState();
+}
+
+// Read the physics state of the hand (first update phase)
+void AHand::ReadPhysicsState()
+{
+	// Read the physics state once for all consumers of this tick
+	AHand::UpdateHandState();
+
+	// Mass moved by the tracking, includes the objects welded by a fixation grasp
+	if (bTrackRootBodyOnly || bScheduleTrackingGains)
+	{
+		FBodyInstance* const RootBody = GetSkeletalMeshComponent()->GetBodyInstance();
+		TrackingMass = FingersMass + (RootBody ? RootBody->GetBodyMass() : 0.0f);
+	}
+	if (bScheduleTrackingGains)
+	{
+		AHand::UpdateTrackingGainSchedule();
+	}
+
+	// Object of the force grasp, checked for promotion in the compute phase
+	HybridCandidate = nullptr;
+	if (bHybridGraspEnabled && !bHybridGraspPromoted && !OneHandGraspedObject && !TwoHandsGraspedObject
+		&& !bTwoHandsConstrained && GraspInputAlpha > HybridDemoteGraspAlpha && OneHandGraspableObjects.Num() > 0)
+	{
+		HybridCandidate = AHand::GetBestOneHandFixationGraspCandidate();
+		if (HybridCandidate)
+		{
+			HybridCandidateRelativeSpeed = (HybridCandidate->GetStaticMeshComponent()->GetPhysicsLinearVelocity()
+				- HandState.RootLinearVelocity).Size();
+			bHybridCandidateTouched = AHand::IsHeldByFingertips(HybridCandidate);
+		}
+	}
+}
+
+// Compute the hand controllers from the state read, only hand local data is written (second update phase)
+void AHand::ComputeControl(const float DeltaTime)
+{
+	// Grasp pose interpolation and status, the fingers keep their targets while the grasp is promoted,
+	// on substeps the controller is stepped by the physics thread and only its status is read here
+	if (bFixedTimestepGrasp && GraspPtr.IsValid())
+	{
+		if (bGraspControlOnSubsteps)
+		{
+			GraspPtr->FetchSubstepGraspStatus();
+		}
+		else if (!bHybridGraspPromoted)
+		{
+			GraspPtr->ComputeGraspTargets(DeltaTime);
+		}
+	}
+
+	AHand::UpdateHybridGrasp(DeltaTime);
+
+	// Force based movement of the hand to the target location and rotation (once per frame),
+	// with a batch slot the output is computed by the hand manager for all hands together
+	if (bHasTrackingTarget && !bTrackingOnSubsteps)
+	{
+		AHand::ComputeTrackingError(TrackingTarget, HandState.RootTransform, TrackingLocationError, TrackingRotationError, bRotationPDControl);
+		if (TrackingBatchSlot == INDEX_NONE)
+		{
+			TrackingForce = TrackingPIDController.UpdateAsPD(TrackingLocationError, DeltaTime);
+			TrackingAngularVelocity = bRotationPDControl
+				? AHand::ComputeRotationPD(TrackingRotationError, HandState.RootAngularVelocity)
+				: TrackingRotationError * TrackingRotationBoost;
+		}
+	}
+
 	//Debug
-	if (this->HandType == EHandType::Right && GraspPtr.IsValid())
+	if (bShowJointForces && GraspPtr.IsValid())
 	{
 		TickValue += DeltaTime;
 
 		if (TickValue > 0.2)
 		{
 			TickValue = 0.0f;
-			GraspPtr->PrintHandInfo(this);
+			bShowJointForcesPending = true;
 		}
 	}
+}
 
-	if (bMovementMimickingHand)
+// Apply the controller output to physics (third update phase)
+void AHand::WritePhysicsState()
+{
+	USkeletalMeshComponent* const SkelMeshComp = GetSkeletalMeshComponent();
+
+	if (bHasTrackingTarget && !bTrackingOnSubsteps)
 	{
-		//SetActorLocation(OtherHand->GetActorLocation() + MimickingRelativeLocation);
-		//SetActorRotation(OtherHand->GetActorQuat() * MimickingRelativeRotation);
-		//UE_LOG(LogTemp, Warning, TEXT("%s : is mimicking hand"), *GetName());
+		AHand::ApplyTrackingOutput(TrackingForce, TrackingAngularVelocity, false);
+	}
 
-		//if (OtherHand)
-		//{
-		//	TArray<AActor*> AttachedActors;
-		//	OtherHand->GetAttachedActors(AttachedActors);
-		//	for (const auto& ActItr : AttachedActors)
-		//	{
-		//		UE_LOG(LogTemp, Warning, TEXT(" \t\t Attached actor: %s"), *ActItr->GetName());
-		//	}
-		//}
+	if (bFixedTimestepGrasp && !bGraspControlOnSubsteps && !bHybridGraspPromoted && GraspPtr.IsValid())
+	{
+		GraspPtr->ApplyGraspTargets(this);
+	}
 
-		//if (!AHand::IsTwoHandGraspStillValid())
-		//{
-		//	AHand::DetachFixationGrasp();
-		//}
+	// Switch between the force grasp and the fixation grasp
+	if (bHybridPromotePending)
+	{
+		bHybridPromotePending = false;
+		AHand::PromoteHybridGrasp();
+	}
+	else if (bHybridDemotePending)
+	{
+		bHybridDemotePending = false;
+		AHand::DetachFixationGrasp();
+	}
+
+	// Custom physics is consumed every frame, register it for the upcoming substeps
+	const bool bSubstepGrasp = bFixedTimestepGrasp && bGraspControlOnSubsteps;
+	// The callback on the own root body also computes the batched substep tracking of the hand
+	SubstepTrackingManager = TrackingBatchSlot != INDEX_NONE && HandManager.IsValid() ? HandManager.Get() : nullptr;
+	const bool bSubstepTracking = bTrackingOnSubsteps && bHasTrackingTarget;
+	if ((bSubstepGrasp || bSubstepTracking) && OnCalculateCustomPhysics.IsBound())
+	{
+		FBodyInstance* const RootBody = SkelMeshComp->GetBodyInstance();
+		if (RootBody)
+		{
+			RootBody->AddCustomPhysics(OnCalculateCustomPhysics);
+		}
+	}
+
+	// Debug output is printed on the game thread after all hands are computed
+	if (bShowJointForcesPending)
+	{
+		bShowJointForcesPending = false;
+		GraspPtr->PrintHandInfo(this);
+	}
+}
+
+// Set the gains of the force based tracking of the hand
+void AHand::SetTrackingController(const float PGain, const float IGain, const float DGain,
+	const float MaxOutput, const float InRotationBoost)
+{
+	TrackingPIDController.SetValues(PGain, IGain, DGain, MaxOutput, -MaxOutput);
+	TrackingRotationBoost = InRotationBoost;
+	TrackingPGain = PGain;
+	TrackingDGain = DGain;
+	TrackingMaxOutput = MaxOutput;
+
+	// The generated schedule derives from these gains
+	BaseTrackingGains.PGain = PGain;
+	BaseTrackingGains.IGain = IGain;
+	BaseTrackingGains.DGain = DGain;
+	BaseTrackingGains.MaxOutput = MaxOutput;
+	BaseTrackingGains.RotationBoost = InRotationBoost;
+	bGainScheduleDirty = true;
+}
+
+// Build the gain schedule out of the configured table or out of the base gains
+void AHand::SetupTrackingGainSchedule()
+{
+	ActiveGainSchedule = TrackingGainSchedule;
+	if (ActiveGainSchedule.Num() == 0 && BareHandMass > 0.0f)
+	{
+		// Buckets of added mass (kg), the output is already mass compensated, so the gains would track every load alike,
+		// heavier loads are tracked softer to bound the force on them (growing with the square root of the mass),
+		// the derivative gain and the rotation follow the square root of the stiffness so the damping ratio is kept
+		static const float AddedMasses[] = { 0.25f, 0.5f, 1.0f, 2.0f, 3.5f, 5.0f, 7.5f, 10.0f };
+		for (const float AddedMass : AddedMasses)
+		{
+			const float StiffnessScale = FMath::Sqrt(BareHandMass / (BareHandMass + AddedMass));
+			const float BandwidthScale = FMath::Sqrt(StiffnessScale);
+			FTrackingGains Gains = BaseTrackingGains;
+			Gains.MaxMass = BareHandMass + AddedMass;
+			Gains.PGain = BaseTrackingGains.PGain * StiffnessScale;
+			Gains.IGain = BaseTrackingGains.IGain * StiffnessScale * BandwidthScale;
+			Gains.DGain = BaseTrackingGains.DGain * BandwidthScale;
+			Gains.RotationBoost = BaseTrackingGains.RotationBoost * BandwidthScale;
+			ActiveGainSchedule.Add(Gains);
+		}
+		ActiveGainSchedule[0] = BaseTrackingGains;
+		ActiveGainSchedule[0].MaxMass = BareHandMass + AddedMasses[0];
+	}
+	ActiveGainSchedule.Sort([](const FTrackingGains& A, const FTrackingGains& B) { return A.MaxMass < B.MaxMass; });
+
+	bGainScheduleDirty = false;
+	TrackingGainBucket = INDEX_NONE;
+	ScheduledMass = 0.0f;
+}
+
+// Select the gain bucket of the moved mass, only if the mass changed (read phase)
+void AHand::UpdateTrackingGainSchedule()
+{
+	if (bGainScheduleDirty)
+	{
+		AHand::SetupTrackingGainSchedule();
+	}
+	if (ActiveGainSchedule.Num() == 0 || FMath::IsNearlyEqual(TrackingMass, ScheduledMass, 0.01f))
+	{
+		return;
+	}
+	ScheduledMass = TrackingMass;
+
+	// First bucket holding the mass, heavier masses use the last bucket
+	int32 Bucket = ActiveGainSchedule.Num() - 1;
+	for (int32 Index = 0; Index < ActiveGainSchedule.Num(); ++Index)
+	{
+		if (TrackingMass <= ActiveGainSchedule[Index].MaxMass)
+		{
+			Bucket = Index;
+			break;
+		}
+	}
+	if (Bucket != TrackingGainBucket)
+	{
+		TrackingGainBucket = Bucket;
+		AHand::ApplyTrackingGains(ActiveGainSchedule[Bucket]);
+	}
+}
+
+// Set the gains of the tracking controllers
+void AHand::ApplyTrackingGains(const FTrackingGains& Gains)
+{
+	TrackingPIDController.SetValues(Gains.PGain, Gains.IGain, Gains.DGain, Gains.MaxOutput, -Gains.MaxOutput);
+	TrackingRotationBoost = Gains.RotationBoost;
+	TrackingPGain = Gains.PGain;
+	TrackingDGain = Gains.DGain;
+	TrackingMaxOutput = Gains.MaxOutput;
+}
+
+// Gains of the tracking controller
+void AHand::GetTrackingGains(float& OutPGain, float& OutDGain, float& OutMaxOutput, float& OutRotationBoost) const
+{
+	OutPGain = TrackingPGain;
+	OutDGain = TrackingDGain;
+	OutMaxOutput = TrackingMaxOutput;
+	OutRotationBoost = TrackingRotationBoost;
+}
+
+// Gains of the rotation PD controller
+void AHand::GetRotationPDGains(float& OutPGain, float& OutDGain, float& OutMaxAngularAcceleration) const
+{
+	OutPGain = RotationPGain;
+	OutDGain = RotationDGain;
+	OutMaxAngularAcceleration = MaxAngularAcceleration;
+}
+
+// Set the tracking output computed by the batched controllers of the hand manager
+void AHand::SetTrackingOutput(const FVector& Force, const FVector& RotationOutput)
+{
+	TrackingForce = Force;
+	TrackingAngularVelocity = RotationOutput;
+}
+
+// Set the world pose the hand should be moved to
+void AHand::SetTrackingTarget(const FTransform& InTarget)
+{
+	TrackingTarget = InTarget;
+	TrackingTargetMailbox.Post(InTarget);
+	bHasTrackingTarget = true;
+}
+
+// Stop moving the hand to the tracking target
+void AHand::ClearTrackingTarget()
+{
+	bHasTrackingTarget = false;
+	TrackingForce = FVector::ZeroVector;
+	TrackingAngularVelocity = FVector::ZeroVector;
+}
+
+// Called on every physics substep
+void AHand::SubstepTick(float DeltaTime, FBodyInstance* BodyInstance)
+{
+	// With a batch slot the substep tracking is computed in the batched controllers of the hand manager
+	if (bTrackingOnSubsteps && bHasTrackingTarget)
+	{
+		if (SubstepTrackingManager)
+		{
+			SubstepTrackingManager->UpdateTrackingSubstep(this, DeltaTime);
+		}
+		else
+		{
+			AHand::UpdateTrackingSubstep(DeltaTime, BodyInstance);
+		}
+	}
+
+	if (bFixedTimestepGrasp && bGraspControlOnSubsteps && GraspPtr.IsValid() && !bHybridGraspPromoted)
+	{
+		GraspPtr->UpdateGraspSubstep(DeltaTime, this);
+	}
+}
+
+// Move the hand to the latest tracking target, called on every physics substep
+void AHand::UpdateTrackingSubstep(const float DeltaTime, FBodyInstance* RootBody)
+{
+	// Latest pose posted by the game thread
+	TrackingTargetMailbox.Fetch(SubstepTrackingTarget);
+	if (!RootBody || !TrackingTargetMailbox.HasValue())
+		return;
+
+	// Current pose of the component, from the root body of this substep
+	const FTransform CurrentTransform = RootBodyToComponent * RootBody->GetUnrealWorldTransform_AssumesLocked();
+
+	FVector Force;
+	FVector RotationOutput;
+	AHand::ComputeTrackingOutput(SubstepTrackingTarget, CurrentTransform,
+		RootBody->GetUnrealWorldAngularVelocityInRadians_AssumesLocked(), DeltaTime, Force, RotationOutput);
+	AHand::ApplyTrackingOutput(Force, RotationOutput, true);
+}
+
+// Tracking errors and angular velocity of the root body of this substep, false if there is no target yet
+bool AHand::ComputeSubstepTrackingError(FVector& OutLocationError, FVector& OutRotationError, FVector& OutAngularVelocity)
+{
+	// Latest pose posted by the game thread
+	TrackingTargetMailbox.Fetch(SubstepTrackingTarget);
+	FBodyInstance* const RootBody = GetSkeletalMeshComponent()->GetBodyInstance();
+	if (!RootBody || !TrackingTargetMailbox.HasValue())
+		return false;
+
+	const FTransform CurrentTransform = RootBodyToComponent * RootBody->GetUnrealWorldTransform_AssumesLocked();
+	AHand::ComputeTrackingError(SubstepTrackingTarget, CurrentTransform, OutLocationError, OutRotationError, bRotationPDControl);
+	OutAngularVelocity = RootBody->GetUnrealWorldAngularVelocityInRadians_AssumesLocked();
+	return true;
+}
+
+// Apply the tracking output computed by the batched controllers of the hand manager
+void AHand::ApplySubstepTrackingOutput(const FVector& Force, const FVector& RotationOutput)
+{
+	AHand::ApplyTrackingOutput(Force, RotationOutput, true);
+}
+
+// Location error and rotation error (xyz of the shortest rotation) of the current pose to the target pose
+void AHand::ComputeTrackingError(const FTransform& Target, const FTransform& Current,
+	FVector& OutLocationError, FVector& OutRotationError, const bool bAngleAxisError)
+{
+	OutLocationError = Target.GetLocation() - Current.GetLocation();
+
+	const FQuat TargetQuat = Target.GetRotation();
+	FQuat CurrQuat = Current.GetRotation();
+	// Avoid taking the long path around the sphere
+	if ((TargetQuat | CurrQuat) < 0)
+	{
+		CurrQuat *= -1.f;
+	}
+	const FQuat OutputFromQuat = TargetQuat * CurrQuat.Inverse();
+	if (bAngleAxisError)
+	{
+		// Rotation axis scaled by the angle (rad), the same hemisphere keeps the angle below pi
+		FVector Axis;
+		float Angle;
+		OutputFromQuat.ToAxisAndAngle(Axis, Angle);
+		OutRotationError = Axis * Angle;
+		return;
+	}
+	// Use the xyz part of the quat as the rotation velocity
+	OutRotationError = FVector(OutputFromQuat.X, OutputFromQuat.Y, OutputFromQuat.Z);
+}
+
+// Torque giving the body the angular acceleration, the inertia tensor is diagonal in the mass space of the body
+FVector AHand::AngularAccelerationToTorque(const FBodyInstance* Body, const FVector& AngularAcceleration, const bool bAssumesLocked)
+{
+	FQuat MassSpaceRotation;
+	FVector InertiaTensor;
+#if WITH_PHYSX
+	if (bAssumesLocked)
+	{
+		// The scene is already locked in the physics substep
+		const PxRigidBody* const PRigidBody = Body->GetPxRigidBody_AssumesLocked();
+		if (!PRigidBody)
+		{
+			return FVector::ZeroVector;
+		}
+		MassSpaceRotation = Body->GetUnrealWorldTransform_AssumesLocked().GetRotation() * P2UQuat(PRigidBody->getCMassLocalPose().q);
+		InertiaTensor = P2UVector(PRigidBody->getMassSpaceInertiaTensor());
+	}
+	else
+#endif
+	{
+		MassSpaceRotation = Body->GetMassSpaceToWorldSpace().GetRotation();
+		InertiaTensor = Body->GetBodyInertiaTensor();
+	}
+	const FVector LocalAcceleration = MassSpaceRotation.UnrotateVector(AngularAcceleration);
+	return MassSpaceRotation.RotateVector(InertiaTensor * LocalAcceleration);
+}
+
+// PD angular acceleration (rad/s^2) from the rotation error and the angular velocity,
+// damping the measured velocity instead of the difference of the errors keeps the derivative noise free
+FVector AHand::ComputeRotationPD(const FVector& RotationError, const FVector& AngularVelocity) const
+{
+	const FVector Output = RotationPGain * RotationError - RotationDGain * AngularVelocity;
+	return Output.BoundToCube(MaxAngularAcceleration);
+}
+
+// PD force and angular velocity (deg/s) or angular acceleration (rad/s^2, rotation PD) moving the current pose to the target pose
+void AHand::ComputeTrackingOutput(const FTransform& Target, const FTransform& Current, const FVector& CurrentAngularVelocity,
+	const float DeltaTime, FVector& OutForce, FVector& OutRotationOutput)
+{
+	FVector LocationError;
+	FVector RotationError;
+	AHand::ComputeTrackingError(Target, Current, LocationError, RotationError, bRotationPDControl);
+	OutForce = TrackingPIDController.UpdateAsPD(LocationError, DeltaTime);
+	OutRotationOutput = bRotationPDControl
+		? AHand::ComputeRotationPD(RotationError, CurrentAngularVelocity)
+		: RotationError * TrackingRotationBoost;
+}
+
+// Apply the tracking output to the root body or to all bodies of the hand,
+// the bodies are written directly, the component functions are not safe during the substep
+void AHand::ApplyTrackingOutput(const FVector& Force, const FVector& RotationOutput, const bool bInSubstep)
+{
+	USkeletalMeshComponent* const SkelMeshComp = GetSkeletalMeshComponent();
+	const FVector AngularVelocityRad = FMath::DegreesToRadians(RotationOutput);
+	LastTrackingCommitCycles.Set(static_cast<int64>(FPlatformTime::Cycles64()));
+
+	if (bTrackRootBodyOnly)
+	{
+		// The force accelerating the whole hand, only the root body is written
+		FBodyInstance* const RootBody = SkelMeshComp->GetBodyInstance();
+		if (RootBody)
+		{
+			RootBody->AddForce(Force * TrackingMass, !bInSubstep, false);
+			if (bRotationPDControl)
+			{
+				// As torque with the inertia of the root body, welding an object updates its mass properties,
+				// the fingers are only connected through their joints and are not part of the inertia
+				RootBody->AddTorque(AHand::AngularAccelerationToTorque(RootBody, RotationOutput, bInSubstep), !bInSubstep, false);
+			}
+			else
+			{
+				RootBody->SetAngularVelocityInRadians(AngularVelocityRad, false);
+			}
+		}
+		return;
+	}
+
+	for (FBodyInstance* const Body : SkelMeshComp->Bodies)
+	{
+		if (Body)
+		{
+			Body->AddForce(Force, !bInSubstep, true);
+			if (bRotationPDControl)
+			{
+				// As torque with the inertia of each body, like the root body in the root only mode
+				Body->AddTorque(AHand::AngularAccelerationToTorque(Body, RotationOutput, bInSubstep), !bInSubstep, false);
+			}
+			else
+			{
+				Body->SetAngularVelocityInRadians(AngularVelocityRad, false);
+			}
+		}
 	}
 }
 
@@ -145,13 +704,33 @@ void AHand::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChanged
 // Check if the object in reach is one-, two-hand(s), or not graspable
 void AHand::OnFixationGraspAreaBeginOverlap(class UPrimitiveComponent* HitComp, class AActor* OtherActor,
 	class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult)
+{
+	AHand::OnObjectInReach(OtherActor);
+}
+
+// Object out or grasping reach, remove as possible grasp object
+void AHand::OnFixationGraspAreaEndOverlap(class UPrimitiveComponent* HitComp, class AActor* OtherActor,
+	class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	AHand::OnObjectLeftReach(OtherActor);
+}
+
+// Get the sphere in which objects can be fixation grasped
+bool AHand::GetFixationGraspReach(FSphere& OutSphere) const
+{
+	OutSphere = FSphere(FixationGraspArea->GetComponentLocation(), FixationGraspArea->GetScaledSphereRadius());
+	return bFixationGraspAreaEnabled;
+}
+
+// Check if the object in reach is one-, two-hand(s), or not graspable
+void AHand::OnObjectInReach(AActor* OtherActor)
 {
 	// Check if object is graspable
 	const uint8 GraspType = CheckObjectGraspableType(OtherActor);
 
 	if (GraspType == ONE_HAND_GRASPABLE)
 	{
-		OneHandGraspableObjects.Emplace(Cast<AStaticMeshActor>(OtherActor));
+		OneHandGraspableObjects.AddUnique(Cast<AStaticMeshActor>(OtherActor));
 	}
 	else if (GraspType == TWO_HANDS_GRASPABLE)
 	{
@@ -160,8 +739,7 @@ void AHand::OnFixationGraspAreaBeginOverlap(class UPrimitiveComponent* HitComp,
 }
 
 // Object out or grasping reach, remove as possible grasp object
-void AHand::OnFixationGraspAreaEndOverlap(class UPrimitiveComponent* HitComp, class AActor* OtherActor,
-	class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void AHand::OnObjectLeftReach(AActor* OtherActor)
 {
 	// If present, remove from the graspable objects
 	OneHandGraspableObjects.Remove(Cast<AStaticMeshActor>(OtherActor));
@@ -174,6 +752,24 @@ void AHand::OnFixationGraspAreaEndOverlap(class UPrimitiveComponent* HitComp, cl
 	}
 }
 
+// Enable or disable looking for objects in the fixation grasp area
+void AHand::SetFixationGraspAreaEnabled(const bool bEnabled)
+{
+	bFixationGraspAreaEnabled = bEnabled;
+	if (ProximityService.IsValid())
+	{
+		// Objects are reported again by the next query after re-enabling
+		if (!bEnabled)
+		{
+			ProximityService->ResetHand(this);
+		}
+	}
+	else
+	{
+		FixationGraspArea->bGenerateOverlapEvents = bEnabled;
+	}
+}
+
 // Update the grasp pose
 void AHand::UpdateGrasp(const float Goal)
 {
@@ -209,7 +805,17 @@ void AHand::UpdateGrasp(const float Goal)
 // Physics based grasping
 void AHand::UpdateGrasp2(const float Alpha)
 {
-	GraspPtr->UpdateGrasp(Alpha, VelocityThreshold, this);
+	GraspInputAlpha = Alpha;
+
+	if (bFixedTimestepGrasp)
+	{
+		// Applied by the fixed timestep controller on the next physics substep
+		GraspPtr->SetTargetAlpha(Alpha);
+	}
+	else if (!bHybridGraspPromoted)
+	{
+		GraspPtr->UpdateGrasp(Alpha, VelocityThreshold, this);
+	}
 }
 
 // Fixation grasp via attachment of the object to the hand
@@ -218,8 +824,12 @@ bool AHand::TryOneHandFixationGrasp()
 	// If no current grasp is active and there is at least one graspable object
 	if ((!OneHandGraspedObject) && (OneHandGraspableObjects.Num() > 0))
 	{
-		// Get the object to be grasped from the pool of objects
-		OneHandGraspedObject = OneHandGraspableObjects.Pop();
+		// Get the best object to be grasped from the pool of objects
+		OneHandGraspedObject = AHand::GetBestOneHandFixationGraspCandidate();
+		if (!OneHandGraspedObject)
+		{
+			return false;
+		}
 
 		// TODO bug report, overlaps flicker when object is attached to hand, this prevents directly attaching objects from one hand to another
 		//if (OneHandGraspedObject->GetAttachParentActor() && OneHandGraspedObject->GetAttachParentActor()->IsA(AHand::StaticClass()))
@@ -229,22 +839,143 @@ bool AHand::TryOneHandFixationGrasp()
 		//	OtherHand->TryDetachFixationGrasp();
 		//}
 
-		// Disable physics on the object and attach it to the hand
-		OneHandGraspedObject->GetStaticMeshComponent()->SetSimulatePhysics(false);
+		// Successful grasp
+		return AHand::AttachOneHandFixationGraspObject(OneHandGraspedObject);
+	}
+	return false;
+}
 
-		/*OneHandGraspedObject->AttachToComponent(GetRootComponent(), FAttachmentTransformRules(
-			EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, true));*/
-		OneHandGraspedObject->AttachToActor(this, FAttachmentTransformRules(
-			EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, true));
+// Disable physics on the object and attach it to the hand
+bool AHand::AttachOneHandFixationGraspObject(AStaticMeshActor* InObject)
+{
+	if (!InObject)
+	{
+		return false;
+	}
+	OneHandGraspedObject = InObject;
 
-		// Disable overlap checks for the fixation grasp area during active grasping
-		FixationGraspArea->bGenerateOverlapEvents = false;
-		// Successful grasp
-		return true;
+	// Disable physics on the object and attach it to the hand
+	OneHandGraspedObject->GetStaticMeshComponent()->SetSimulatePhysics(false);
+
+	/*OneHandGraspedObject->AttachToComponent(GetRootComponent(), FAttachmentTransformRules(
+		EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, true));*/
+	OneHandGraspedObject->AttachToActor(this, FAttachmentTransformRules(
+		EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, true));
+
+	// Disable overlap checks for the fixation grasp area during active grasping
+	AHand::SetFixationGraspAreaEnabled(false);
+
+	// The grasped object is no candidate anymore
+	OneHandGraspableObjects.Remove(InObject);
+	return true;
+}
+
+// Check the stability of the force grasp and decide on promotion or demotion (compute phase)
+void AHand::UpdateHybridGrasp(const float DeltaTime)
+{
+	if (!bHybridGraspEnabled)
+	{
+		return;
+	}
+
+	// The promoted grasp is held until the grasp input is released
+	if (bHybridGraspPromoted)
+	{
+		bHybridDemotePending = GraspInputAlpha < HybridDemoteGraspAlpha;
+		return;
+	}
+
+	if (!HybridCandidate)
+	{
+		HybridStableTime = 0.f;
+		return;
+	}
+
+	// The grasp is stable if the fingers press on the object and it does not slip,
+	// the contact check keeps a hand closed on air next to the object from welding it
+	const bool bStable = bHybridCandidateTouched && AHand::GetGripForce() >= HybridPromoteGripForce
+		&& HybridCandidateRelativeSpeed <= HybridMaxRelativeSpeed;
+	HybridStableTime = bStable ? HybridStableTime + DeltaTime : 0.f;
+	if (HybridStableTime >= HybridPromoteTime)
+	{
+		HybridStableTime = 0.f;
+		bHybridPromotePending = true;
+	}
+}
+
+// Turn the stable force grasp into a fixation grasp (write phase)
+void AHand::PromoteHybridGrasp()
+{
+	if (!HybridCandidate || OneHandGraspedObject || !AHand::AttachOneHandFixationGraspObject(HybridCandidate))
+	{
+		return;
+	}
+	bHybridGraspPromoted = true;
+
+	// Contacts between the hand and the carried object are not needed anymore,
+	// the fingers are frozen in their pose instead of driving into the space of the object
+	UStaticMeshComponent* const ObjectComp = OneHandGraspedObject->GetStaticMeshComponent();
+	HybridObjectCollision = ObjectComp->GetCollisionEnabled();
+	ObjectComp->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	AHand::SetFingerDrivesFrozen(true);
+	UE_LOG(LogTemp, Log, TEXT("AHand: Promoted the force grasp of %s to a fixation grasp"), *OneHandGraspedObject->GetName());
+}
+
+// Check if the thumb and at least one finger touch the object
+bool AHand::IsHeldByFingertips(AStaticMeshActor* InObject) const
+{
+	UStaticMeshComponent* const ObjectComp = InObject ? InObject->GetStaticMeshComponent() : nullptr;
+	if (!ObjectComp)
+	{
+		return false;
+	}
+
+	// Distance of the distal bones to the collision of the object, 0 inside of it
+	auto IsTouching = [this, ObjectComp](const EFingerType FingerType)
+	{
+		const FJointState& Distal = HandState.GetJoint(FingerType, EFingerPart::Distal);
+		if (!Distal.bValid)
+		{
+			return false;
+		}
+		FVector ClosestPoint;
+		const float Distance = ObjectComp->GetDistanceToCollision(Distal.BodyTransform.GetLocation(), ClosestPoint);
+		return Distance >= 0.f && Distance <= HybridContactDistance;
+	};
+
+	const EFingerType Fingers[] = { EFingerType::Index, EFingerType::Middle, EFingerType::Ring, EFingerType::Pinky };
+	if (!IsTouching(EFingerType::Thumb))
+	{
+		return false;
+	}
+	for (const EFingerType FingerType : Fingers)
+	{
+		if (IsTouching(FingerType))
+		{
+			return true;
+		}
 	}
 	return false;
 }
 
+// Freeze the fingers in their pose or drive them to the grasp targets again
+void AHand::SetFingerDrivesFrozen(const bool bFrozen)
+{
+	// Without spring the drives only damp the finger motion, the pose is kept
+	const float DriveSpring = bFrozen ? 0.f : Spring;
+	FFinger* const Fingers[] = { &Thumb, &Index, &Middle, &Ring, &Pinky };
+	for (FFinger* const Finger : Fingers)
+	{
+		Finger->SetFingerDriveParams(DriveSpring, Damping, ForceLimit);
+	}
+
+	// Without the fixed timestep controller the next grasp input drives the fingers again
+	if (!bFrozen && bFixedTimestepGrasp && GraspPtr.IsValid())
+	{
+		GraspPtr->RestoreDriveTargets(bGraspControlOnSubsteps);
+	}
+}
+
 // Fixation grasp of two hands attachment
 bool AHand::TryTwoHandsFixationGrasp()
 {
@@ -275,7 +1006,7 @@ bool AHand::TryTwoHandsFixationGrasp()
 			UE_LOG(LogTemp, Warning, TEXT("AHand: TwoHand Attached %s to %s"), *TwoHandsGraspedObject->GetName(), *GetName());
 
 			// Disable overlaps of the fixation grasp area during the active grasp
-			FixationGraspArea->bGenerateOverlapEvents = false;
+			AHand::SetFixationGraspAreaEnabled(false);
 
 			// Set other hands grasp as well
 			OtherHand->TwoHandsFixationGraspFromOther();
@@ -292,15 +1023,18 @@ void AHand::TwoHandsFixationGraspFromOther()
 	// Clear the pointer to the graspable object
 	TwoHandsGraspableObject = nullptr;
 
-	// This hand will only be mimicking the movements with the grasped object
-	SetActorTickEnabled(true);
-	bMovementMimickingHand = true;
-
-	MimickingRelativeLocation = OtherHand->GetActorLocation() - GetActorLocation();
-	MimickingRelativeRotation = OtherHand->GetActorQuat()*GetActorQuat();
+	// Tie this hand to the object attached to the other hand, the physics keeps the relative pose
+	AStaticMeshActor* const GraspedObject = OtherHand ? OtherHand->GetTwoHandsGraspedObject() : nullptr;
+	if (GraspedObject && GraspedObject->GetStaticMeshComponent())
+	{
+		TwoHandsGraspConstraint->SetWorldLocationAndRotation(GetActorLocation(), GetActorQuat());
+		TwoHandsGraspConstraint->SetConstrainedComponents(
+			GetSkeletalMeshComponent(), NAME_None, GraspedObject->GetStaticMeshComponent(), NAME_None);
+		bTwoHandsConstrained = true;
+	}
 
 	// Disable overlaps of the fixation grasp area during the active grasp
-	FixationGraspArea->bGenerateOverlapEvents = false;
+	AHand::SetFixationGraspAreaEnabled(false);
 }
 
 // Detach fixation grasp from hand(s)
@@ -310,7 +1044,7 @@ bool AHand::DetachFixationGrasp()
 	bReadyForTwoHandsGrasp = false;
 
 	// Re-enable overlaps for the fixation grasp area
-	FixationGraspArea->bGenerateOverlapEvents = true;
+	AHand::SetFixationGraspAreaEnabled(true);
 
 	// Release grasp position
 	bGraspHeld = false;
@@ -322,6 +1056,14 @@ bool AHand::DetachFixationGrasp()
 			EDetachmentRule::KeepWorld, EDetachmentRule::KeepWorld, EDetachmentRule::KeepWorld, true));
 		UE_LOG(LogTemp, Warning, TEXT("AHand: Detached %s from %s"), *OneHandGraspedObject->GetName(), *GetName());
 
+		// Demoted back to a force grasp, the fingers are in contact again
+		if (bHybridGraspPromoted)
+		{
+			OneHandGraspedObject->GetStaticMeshComponent()->SetCollisionEnabled(HybridObjectCollision);
+			bHybridGraspPromoted = false;
+			AHand::SetFingerDrivesFrozen(false);
+		}
+
 		// Enable physics with and apply current hand velocity, clear pointer to object
 		OneHandGraspedObject->GetStaticMeshComponent()->SetSimulatePhysics(true);
 		OneHandGraspedObject->GetStaticMeshComponent()->SetPhysicsLinearVelocity(GetVelocity());
@@ -343,11 +1085,11 @@ bool AHand::DetachFixationGrasp()
 		OtherHand->DetachTwoHandFixationGraspFromOther();
 		return true;
 	}
-	else if (bMovementMimickingHand && OtherHand)
+	else if (bTwoHandsConstrained && OtherHand)
 	{
-		// Disable mimicking hand
-		SetActorTickEnabled(false);
-		bMovementMimickingHand = false;
+		// Release the hand from the object
+		TwoHandsGraspConstraint->BreakConstraint();
+		bTwoHandsConstrained = false;
 
 		// Trigger detachment on other hand as well
 		OtherHand->DetachTwoHandFixationGraspFromOther();
@@ -360,9 +1102,9 @@ bool AHand::DetachFixationGrasp()
 bool AHand::DetachTwoHandFixationGraspFromOther()
 {
 	// Re-enable overlaps for the fixation grasp area
-	FixationGraspArea->bGenerateOverlapEvents = true;
+	AHand::SetFixationGraspAreaEnabled(true);
 
-	// Check grasp type of the hand (attachment or movement mimicking)
+	// Check grasp type of the hand (attachment or constraint)
 	if (TwoHandsGraspedObject)
 	{
 		// Detach object from hand
@@ -375,11 +1117,11 @@ bool AHand::DetachTwoHandFixationGraspFromOther()
 		TwoHandsGraspedObject = nullptr;
 		return true;
 	}
-	else if (bMovementMimickingHand)
+	else if (bTwoHandsConstrained)
 	{
-		// Disable mimicking hand
-		SetActorTickEnabled(false);
-		bMovementMimickingHand = false;
+		// Release the hand from the object
+		TwoHandsGraspConstraint->BreakConstraint();
+		bTwoHandsConstrained = false;
 		return true;
 	}
 	return false;
@@ -399,38 +1141,81 @@ void AHand::SetOtherHand(AHand* InOtherHand)
 
 }
 
+// Mass and length limits of the fixation grasp
+FGraspabilityLimits AHand::GetGraspabilityLimits() const
+{
+	FGraspabilityLimits Limits;
+	Limits.OneHandMaxMass = OneHandFixationMaximumMass;
+	Limits.OneHandMaxLength = OneHandFixationMaximumLength;
+	Limits.TwoHandsMaxMass = TwoHandsFixationMaximumMass;
+	Limits.TwoHandsMaxLength = TwoHandsFixationMaximumLength;
+	return Limits;
+}
+
 // Check how the object graspable
 uint8 AHand::CheckObjectGraspableType(AActor* InActor)
 {
-	// Check if the static mesh actor can be grasped
-	AStaticMeshActor* const SMActor = Cast<AStaticMeshActor>(InActor);
-	if (SMActor)
+	const FGraspabilityLimits Limits = AHand::GetGraspabilityLimits();
+
+	// Mass and bounds are cached until the mesh, scale or physics of the object change
+	const FGraspableObjectInfo* const ObjectInfo = GraspableObjectRegistry::Get(InActor, Limits);
+	if (ObjectInfo)
 	{
-		// Get the static mesh component
-		UStaticMeshComponent* const SMComp = SMActor->GetStaticMeshComponent();
-		if (SMComp)
-		{
-			// Check that actor is movable, has a static mesh component, has physics on,
-			// and has one hand graspable dimensions
-			if (SMActor->IsRootComponentMovable() &&
-				SMComp->IsSimulatingPhysics() &&
-				SMComp->GetMass() < OneHandFixationMaximumMass &&
-				SMActor->GetComponentsBoundingBox().GetSize().Size() < OneHandFixationMaximumLength)
-			{
-				return ONE_HAND_GRASPABLE;
-			}
-			// check for two hand graspable dimensions
-			else if (SMComp->GetMass() < TwoHandsFixationMaximumMass &&
-				SMActor->GetComponentsBoundingBox().GetSize().Size() < TwoHandsFixationMaximumLength)
-			{
-				return TWO_HANDS_GRASPABLE;
-			}
-		}
+		return ObjectInfo->GraspableType;
 	}
 	// Actor cannot be attached
 	return NOT_GRASPABLE;
 }
 
+// Get the best scored one hand graspable object
+AStaticMeshActor* AHand::GetBestOneHandFixationGraspCandidate() const
+{
+	const FGraspabilityLimits Limits = AHand::GetGraspabilityLimits();
+
+	const FVector PalmLocation = FixationGraspArea->GetComponentLocation();
+	const FVector PalmWorldDirection = GetActorQuat().RotateVector(PalmDirection.GetSafeNormal());
+	const float ReachRadius = FMath::Max(FixationGraspArea->GetScaledSphereRadius(), KINDA_SMALL_NUMBER);
+	const float MaxLength = FMath::Max(OneHandFixationMaximumLength, KINDA_SMALL_NUMBER);
+
+	int32 BestIndex = INDEX_NONE;
+	float BestScore = -BIG_NUMBER;
+
+	// Only the most recent candidates are scored to keep the grasp latency bounded
+	const int32 FirstIndex = FMath::Max(0, OneHandGraspableObjects.Num() - MaxFixationGraspCandidates);
+	for (int32 CandidateIndex = OneHandGraspableObjects.Num() - 1; CandidateIndex >= FirstIndex; --CandidateIndex)
+	{
+		AStaticMeshActor* const Candidate = OneHandGraspableObjects[CandidateIndex];
+		if (!Candidate || Candidate->IsPendingKill())
+		{
+			continue;
+		}
+
+		const FGraspableObjectInfo* const ObjectInfo = GraspableObjectRegistry::Get(Candidate, Limits);
+		if (!ObjectInfo || ObjectInfo->GraspableType != ONE_HAND_GRASPABLE)
+		{
+			continue;
+		}
+
+		// Distance from the palm to the object surface (approximated by its bounds), relative to the reach
+		const FVector ObjectCenter = Candidate->GetActorTransform().TransformPosition(ObjectInfo->BoundsOrigin);
+		const FVector ToObject = ObjectCenter - PalmLocation;
+		const float SurfaceDistance = FMath::Max(ToObject.Size() - ObjectInfo->BoundsExtent.GetMin(), 0.f);
+
+		const float Score =
+			- CandidateDistanceWeight * (SurfaceDistance / ReachRadius)
+			+ CandidateAlignmentWeight * (PalmWorldDirection | ToObject.GetSafeNormal())
+			- CandidateSizeWeight * (ObjectInfo->Length / MaxLength);
+
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			BestIndex = CandidateIndex;
+		}
+	}
+
+	return BestIndex != INDEX_NONE ? OneHandGraspableObjects[BestIndex] : nullptr;
+}
+
 // Hold grasp in the current position
 void AHand::MaintainFingerPositions()
 {
@@ -476,60 +1261,33 @@ void AHand::MaintainFingerPositions()
 // Setup hand default values
 void AHand::SetupHandDefaultValues(EHandType InHandType)
 {
-	if (InHandType == EHandType::Left)
-	{
-		Thumb.FingerType = EFingerType::Thumb;
-		Thumb.FingerPartToBoneName.Add(EFingerPart::Proximal, "thumb_01_r");
-		Thumb.FingerPartToBoneName.Add(EFingerPart::Intermediate, "thumb_02_r");
-		Thumb.FingerPartToBoneName.Add(EFingerPart::Distal, "thumb_03_r");
-
-		Index.FingerType = EFingerType::Index;
-		Index.FingerPartToBoneName.Add(EFingerPart::Proximal, "index_01_r");
-		Index.FingerPartToBoneName.Add(EFingerPart::Intermediate, "index_02_r");
-		Index.FingerPartToBoneName.Add(EFingerPart::Distal, "index_03_r");
-
-		Middle.FingerType = EFingerType::Middle;
-		Middle.FingerPartToBoneName.Add(EFingerPart::Proximal, "middle_01_r");
-		Middle.FingerPartToBoneName.Add(EFingerPart::Intermediate, "middle_02_r");
-		Middle.FingerPartToBoneName.Add(EFingerPart::Distal, "middle_03_r");
-
-		Ring.FingerType = EFingerType::Ring;
-		Ring.FingerPartToBoneName.Add(EFingerPart::Proximal, "ring_01_r");
-		Ring.FingerPartToBoneName.Add(EFingerPart::Intermediate, "ring_02_r");
-		Ring.FingerPartToBoneName.Add(EFingerPart::Distal, "ring_03_r");
-
-		Pinky.FingerType = EFingerType::Pinky;
-		Pinky.FingerPartToBoneName.Add(EFingerPart::Proximal, "pinky_01_r");
-		Pinky.FingerPartToBoneName.Add(EFingerPart::Intermediate, "pinky_02_r");
-		Pinky.FingerPartToBoneName.Add(EFingerPart::Distal, "pinky_03_r");
-	}
-	else if (InHandType == EHandType::Right)
-	{
-		Thumb.FingerType = EFingerType::Thumb;
-		Thumb.FingerPartToBoneName.Add(EFingerPart::Proximal, "thumb_01_r");
-		Thumb.FingerPartToBoneName.Add(EFingerPart::Intermediate, "thumb_02_r");
-		Thumb.FingerPartToBoneName.Add(EFingerPart::Distal, "thumb_03_r");
-
-		Index.FingerType = EFingerType::Index;
-		Index.FingerPartToBoneName.Add(EFingerPart::Proximal, "index_01_r");
-		Index.FingerPartToBoneName.Add(EFingerPart::Intermediate, "index_02_r");
-		Index.FingerPartToBoneName.Add(EFingerPart::Distal, "index_03_r");
-
-		Middle.FingerType = EFingerType::Middle;
-		Middle.FingerPartToBoneName.Add(EFingerPart::Proximal, "middle_01_r");
-		Middle.FingerPartToBoneName.Add(EFingerPart::Intermediate, "middle_02_r");
-		Middle.FingerPartToBoneName.Add(EFingerPart::Distal, "middle_03_r");
-
-		Ring.FingerType = EFingerType::Ring;
-		Ring.FingerPartToBoneName.Add(EFingerPart::Proximal, "ring_01_r");
-		Ring.FingerPartToBoneName.Add(EFingerPart::Intermediate, "ring_02_r");
-		Ring.FingerPartToBoneName.Add(EFingerPart::Distal, "ring_03_r");
-
-		Pinky.FingerType = EFingerType::Pinky;
-		Pinky.FingerPartToBoneName.Add(EFingerPart::Proximal, "pinky_01_r");
-		Pinky.FingerPartToBoneName.Add(EFingerPart::Intermediate, "pinky_02_r");
-		Pinky.FingerPartToBoneName.Add(EFingerPart::Distal, "pinky_03_r");
-	}
+	// Bone names of the hand side, resolved to the other side at begin play if the skeleton only has those
+	const FString Side = (InHandType == EHandType::Left) ? TEXT("_l") : TEXT("_r");
+
+	Thumb.FingerType = EFingerType::Thumb;
+	Thumb.FingerPartToBoneName.Add(EFingerPart::Proximal, TEXT("thumb_01") + Side);
+	Thumb.FingerPartToBoneName.Add(EFingerPart::Intermediate, TEXT("thumb_02") + Side);
+	Thumb.FingerPartToBoneName.Add(EFingerPart::Distal, TEXT("thumb_03") + Side);
+
+	Index.FingerType = EFingerType::Index;
+	Index.FingerPartToBoneName.Add(EFingerPart::Proximal, TEXT("index_01") + Side);
+	Index.FingerPartToBoneName.Add(EFingerPart::Intermediate, TEXT("index_02") + Side);
+	Index.FingerPartToBoneName.Add(EFingerPart::Distal, TEXT("index_03") + Side);
+
+	Middle.FingerType = EFingerType::Middle;
+	Middle.FingerPartToBoneName.Add(EFingerPart::Proximal, TEXT("middle_01") + Side);
+	Middle.FingerPartToBoneName.Add(EFingerPart::Intermediate, TEXT("middle_02") + Side);
+	Middle.FingerPartToBoneName.Add(EFingerPart::Distal, TEXT("middle_03") + Side);
+
+	Ring.FingerType = EFingerType::Ring;
+	Ring.FingerPartToBoneName.Add(EFingerPart::Proximal, TEXT("ring_01") + Side);
+	Ring.FingerPartToBoneName.Add(EFingerPart::Intermediate, TEXT("ring_02") + Side);
+	Ring.FingerPartToBoneName.Add(EFingerPart::Distal, TEXT("ring_03") + Side);
+
+	Pinky.FingerType = EFingerType::Pinky;
+	Pinky.FingerPartToBoneName.Add(EFingerPart::Proximal, TEXT("pinky_01") + Side);
+	Pinky.FingerPartToBoneName.Add(EFingerPart::Intermediate, TEXT("pinky_02") + Side);
+	Pinky.FingerPartToBoneName.Add(EFingerPart::Distal, TEXT("pinky_03") + Side);
 }
 
 // Setup skeletal mesh default values
@@ -555,23 +1313,30 @@ void AHand::SetupSkeletalDefaultValues(USkeletalMeshComponent* InSkeletalMeshCom
 FORCEINLINE void AHand::SetupAngularDriveValues(EAngularDriveMode::Type DriveMode, EAngularDriveType DriveType)
 {
 	USkeletalMeshComponent* const SkelMeshComp = GetSkeletalMeshComponent();
-	if (Thumb.SetFingerPartsConstraints(SkelMeshComp->Constraints))
+	IndexCache = PhysicsAssetIndexCache::Get(SkelMeshComp->GetPhysicsAsset());
+	if (!IndexCache.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("AHand: SkeletalMeshComponent's has no PhysicsAsset set!"));
+		return;
+	}
+
+	if (Thumb.SetFingerPartsConstraints(SkelMeshComp->Constraints, *IndexCache))
 	{
 		Thumb.SetFingerDriveMode(DriveMode, DriveType, Spring, Damping, ForceLimit);
 	}
-	if (Index.SetFingerPartsConstraints(SkelMeshComp->Constraints))
+	if (Index.SetFingerPartsConstraints(SkelMeshComp->Constraints, *IndexCache))
 	{
 		Index.SetFingerDriveMode(DriveMode, DriveType, Spring, Damping, ForceLimit);
 	}
-	if (Middle.SetFingerPartsConstraints(SkelMeshComp->Constraints))
+	if (Middle.SetFingerPartsConstraints(SkelMeshComp->Constraints, *IndexCache))
 	{
 		Middle.SetFingerDriveMode(DriveMode, DriveType, Spring, Damping, ForceLimit);
 	}
-	if (Ring.SetFingerPartsConstraints(SkelMeshComp->Constraints))
+	if (Ring.SetFingerPartsConstraints(SkelMeshComp->Constraints, *IndexCache))
 	{
 		Ring.SetFingerDriveMode(DriveMode, DriveType, Spring, Damping, ForceLimit);
 	}
-	if (Pinky.SetFingerPartsConstraints(SkelMeshComp->Constraints))
+	if (Pinky.SetFingerPartsConstraints(SkelMeshComp->Constraints, *IndexCache))
 	{
 		Pinky.SetFingerDriveMode(DriveMode, DriveType, Spring, Damping, ForceLimit);
 	}
@@ -587,17 +1352,136 @@ void AHand::ResetAngularDriveValues(EAngularDriveMode::Type DriveMode, EAngularD
 	Pinky.SetFingerDriveMode(DriveMode, DriveType, Spring, Damping, ForceLimit);
 }
 
+// Mirror the right hand pose tables if the skeleton is a left hand
+void AHand::SetupPoseMirroring()
+{
+	if (!GraspPtr.IsValid())
+		return;
+
+	// The side suffix of the resolved bone names tells the handedness of the skeleton,
+	// names without a suffix are taken to match the hand type
+	int32 NumLeftBones = 0;
+	int32 NumRightBones = 0;
+	const FFinger* const Fingers[] = { &Thumb, &Index, &Middle, &Ring, &Pinky };
+	for (const FFinger* const Finger : Fingers)
+	{
+		for (const auto& MapItr : Finger->FingerPartToBoneName)
+		{
+			if (MapItr.Value.EndsWith(TEXT("_l"), ESearchCase::IgnoreCase))
+			{
+				++NumLeftBones;
+			}
+			else if (MapItr.Value.EndsWith(TEXT("_r"), ESearchCase::IgnoreCase))
+			{
+				++NumRightBones;
+			}
+		}
+	}
+	const bool bLeftSkeleton = NumLeftBones != NumRightBones ? NumLeftBones > NumRightBones : HandType == EHandType::Left;
+	GraspPtr->SetPoseMirrorAxis(bLeftSkeleton ? PoseMirrorAxis.GetValue() : EAxis::None);
+}
+
 // Setup finger bones
 FORCEINLINE void AHand::SetupBones()
 {
 	USkeletalMeshComponent* const SkelMeshComp = GetSkeletalMeshComponent();
-	Thumb.SetFingerPartsBones(SkelMeshComp->Bodies);
-	Index.SetFingerPartsBones(SkelMeshComp->Bodies);
-	Middle.SetFingerPartsBones(SkelMeshComp->Bodies);
-	Ring.SetFingerPartsBones(SkelMeshComp->Bodies);
-	Pinky.SetFingerPartsBones(SkelMeshComp->Bodies);
+	if (!IndexCache.IsValid())
+		return;
+
+	Thumb.SetFingerPartsBones(SkelMeshComp->Bodies, *IndexCache);
+	Index.SetFingerPartsBones(SkelMeshComp->Bodies, *IndexCache);
+	Middle.SetFingerPartsBones(SkelMeshComp->Bodies, *IndexCache);
+	Ring.SetFingerPartsBones(SkelMeshComp->Bodies, *IndexCache);
+	Pinky.SetFingerPartsBones(SkelMeshComp->Bodies, *IndexCache);
+}
+
+
+// Map the skeletal constraints to the joints of the hand state
+void AHand::SetupHandStateJointIndices()
+{
+	const TArray<FConstraintInstance*>& Constraints = GetSkeletalMeshComponent()->Constraints;
+	ConstraintToJointIndex.Init(INDEX_NONE, Constraints.Num());
+	JointToConstraintIndex.Init(INDEX_NONE, HandState.Joints.Num());
+	HandState.AngularForces.Init(0.0f, Constraints.Num());
+
+	const FFinger* const Fingers[] = { &Thumb, &Index, &Middle, &Ring, &Pinky };
+	for (const FFinger* Finger : Fingers)
+	{
+		for (const auto& ConstrMapItr : Finger->FingerPartToConstraint)
+		{
+			const int32 ConstraintIndex = Constraints.Find(ConstrMapItr.Value);
+			if (ConstraintIndex != INDEX_NONE)
+			{
+				const int32 JointIndex = FHandStateSnapshot::GetJointIndex(Finger->FingerType, ConstrMapItr.Key);
+				ConstraintToJointIndex[ConstraintIndex] = JointIndex;
+				JointToConstraintIndex[JointIndex] = ConstraintIndex;
+			}
+		}
+	}
 }
 
+// Read the physics state of the hand in a single pass
+void AHand::UpdateHandState()
+{
+	USkeletalMeshComponent* const SkelMeshComp = GetSkeletalMeshComponent();
+
+	HandState.TimeSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	HandState.RootTransform = SkelMeshComp->GetComponentTransform();
+	FBodyInstance* const RootBody = SkelMeshComp->GetBodyInstance();
+	if (RootBody)
+	{
+		HandState.RootLinearVelocity = RootBody->GetUnrealWorldVelocity();
+		HandState.RootAngularVelocity = RootBody->GetUnrealWorldAngularVelocityInRadians();
+	}
+
+	// Constraint forces and angles
+	HandState.MaxAngularForce = 0.0f;
+	const TArray<FConstraintInstance*>& Constraints = SkelMeshComp->Constraints;
+	for (int32 ConstraintIndex = 0; ConstraintIndex < Constraints.Num(); ++ConstraintIndex)
+	{
+		FConstraintInstance* const Constraint = Constraints[ConstraintIndex];
+		if (!Constraint)
+			continue;
+
+		FVector LinearForce;
+		FVector AngularForce;
+		Constraint->GetConstraintForce(LinearForce, AngularForce);
+		const float AngularForceSize = AngularForce.Size();
+		HandState.MaxAngularForce = FMath::Max(HandState.MaxAngularForce, AngularForceSize);
+		if (HandState.AngularForces.IsValidIndex(ConstraintIndex))
+		{
+			HandState.AngularForces[ConstraintIndex] = AngularForceSize;
+		}
+
+		const int32 JointIndex = ConstraintToJointIndex.IsValidIndex(ConstraintIndex) ? ConstraintToJointIndex[ConstraintIndex] : INDEX_NONE;
+		if (JointIndex != INDEX_NONE)
+		{
+			FJointState& Joint = HandState.Joints[JointIndex];
+			Joint.bValid = true;
+			Joint.LinearForce = LinearForce;
+			Joint.AngularForce = AngularForce;
+			Joint.Swing1 = Constraint->GetCurrentSwing1();
+			Joint.Swing2 = Constraint->GetCurrentSwing2();
+			Joint.Twist = Constraint->GetCurrentTwist();
+		}
+	}
+
+	// Finger bone transforms and velocities
+	const FFinger* const Fingers[] = { &Thumb, &Index, &Middle, &Ring, &Pinky };
+	for (const FFinger* Finger : Fingers)
+	{
+		for (const auto& BoneMapItr : Finger->FingerPartToBone)
+		{
+			if (!BoneMapItr.Value)
+				continue;
+
+			FJointState& Joint = HandState.GetJoint(Finger->FingerType, BoneMapItr.Key);
+			Joint.BodyTransform = BoneMapItr.Value->GetUnrealWorldTransform();
+			Joint.LinearVelocity = BoneMapItr.Value->GetUnrealWorldVelocity();
+			Joint.AngularVelocity = BoneMapItr.Value->GetUnrealWorldAngularVelocityInRadians();
+		}
+	}
+}
 
 void AHand::SwitchToNextGraspType(FText & GraspTypeName)
 {
@@ -652,32 +1536,44 @@ void AHand::SwitchGraspProcess()
 
 float AHand::GetMaxAngularForceOfAllConstraints()
 {
-	float MaxForce = 0.0f;;
+	return HandState.MaxAngularForce;
+}
+
+float AHand::GetAngularForceOfConstraint(const FName & JointName)
+{
+	return GetAngularForceOfJoint(GetJointHandle(JointName));
+}
 
-	FVector OutLinearForce;
-	FVector OutAngularForce;
-	for (auto & Constraint : GetSkeletalMeshComponent()->Constraints)
-	{
-		Constraint->GetConstraintForce(OutLinearForce, OutAngularForce);
-		if (OutAngularForce.Size() > MaxForce)
-			MaxForce = OutAngularForce.Size();
-	}
+FHandJointHandle AHand::GetJointHandle(const FName & JointName) const
+{
+	return IndexCache.IsValid() ? FHandJointHandle(IndexCache->FindConstraintIndex(JointName)) : FHandJointHandle();
+}
 
-	return MaxForce;
+FHandJointHandle AHand::GetFingerJointHandle(EFingerType FingerType, EFingerPart FingerPart) const
+{
+	const int32 JointIndex = FHandStateSnapshot::GetJointIndex(FingerType, FingerPart);
+	return JointToConstraintIndex.IsValidIndex(JointIndex) ? FHandJointHandle(JointToConstraintIndex[JointIndex]) : FHandJointHandle();
 }
 
-float AHand::GetAngularForceOfConstraint(const FName & JointName)
+float AHand::GetAngularForceOfJoint(const FHandJointHandle & JointHandle) const
+{
+	return HandState.AngularForces.IsValidIndex(JointHandle.ConstraintIndex) ? HandState.AngularForces[JointHandle.ConstraintIndex] : 0.0f;
+}
+
+float AHand::GetAngularForceOfFingerPart(EFingerType FingerType, EFingerPart FingerPart) const
+{
+	return GetAngularForceOfJoint(GetFingerJointHandle(FingerType, FingerPart));
+}
+
+float AHand::GetGripForce() const
 {
-	FVector OutLinearForce;
-	FVector OutAngularForce;
-	for (auto & Constraint : GetSkeletalMeshComponent()->Constraints)
+	float GripForce = 0.f;
+	for (const FJointState& Joint : HandState.Joints)
 	{
-		if(Constraint->JointName == JointName)
+		if (Joint.bValid)
 		{
-			Constraint->GetConstraintForce(OutLinearForce, OutAngularForce);
-			return OutAngularForce.Size();
+			GripForce += Joint.AngularForce.Size();
 		}
 	}
-
-	return 0;
-}
\ No newline at end of file
+	return GripForce;
+}
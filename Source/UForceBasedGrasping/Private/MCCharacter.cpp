@@ -1,492 +1,868 @@
-// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
-// Author: Andrei Haidu (http://haidu.eu)
-
-#include "MCCharacter.h"
-#include "GameFramework/CharacterMovementComponent.h"
-#include "GameFramework/Controller.h"
-#include "Components/CapsuleComponent.h"
-#include "Components/ArrowComponent.h"
-#include "Components/InputComponent.h"
-#include "Components/SkeletalMeshComponent.h"
-#include "IHeadMountedDisplay.h"
-#include "Kismet/GameplayStatics.h"
-#include "Runtime/UMG/Public/Blueprint/UserWidget.h"
-#include "Engine/Engine.h"
-#include "IXRTrackingSystem.h"
-
-// Sets default values
-AMCCharacter::AMCCharacter()
-{
-	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
-	// Set this pawn to be controlled by the lowest-numbered player
-	AutoPossessPlayer = EAutoReceiveInput::Player0;
-	// Make the capsule thin, and set it only to collide with static objects (VR Mode)
-	GetCapsuleComponent()->SetCapsuleRadius(10);
-	GetCapsuleComponent()->SetCollisionProfileName(TEXT("Spectator"));
-
-	// Set flag default values
-	bShowTargetArrows = true;
-	bUseHandsInitialRotationAsOffset = true;
-	bTryFixationGrasp = true;
-	bTryTwoHandsFixationGrasp = true;
-
-	// Create the motion controller offset (hands in front of the character), attach to root component
-	MCOriginComponent = CreateDefaultSubobject<USceneComponent>(TEXT("MCOriginComponent"));
-	MCOriginComponent->SetupAttachment(GetRootComponent());
-	MCOriginComponent->SetRelativeLocation(FVector(0.0f, 0.0f, -GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
-
-	// Create a CameraComponent, attach to capsule
-	CharCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("MCCharacterCamera"));
-	CharCamera->SetupAttachment(MCOriginComponent);
-	// Default camera for VR use -- relative location at the floor 
-	//CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, -GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
-	//CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, BaseEyeHeight));
-
-	WidgetInteractionComponent = CreateDefaultSubobject<UWidgetInteractionComponent>(TEXT("WindgetInteractionComponent"));
-	WidgetInteractionComponent->SetupAttachment(CharCamera);
-
-	// Create left/right motion controller
-	MCLeft = CreateDefaultSubobject<UMotionControllerComponent>(TEXT("MCLeft"));
-	MCLeft->SetupAttachment(MCOriginComponent);
-	MCLeft->Hand = EControllerHand::Left;
-	MCRight = CreateDefaultSubobject<UMotionControllerComponent>(TEXT("MCRight"));
-	MCRight->SetupAttachment(MCOriginComponent);
-	MCRight->Hand = EControllerHand::Right;
-
-	// Create left/right target vis arrows, attached to the MC
-	LeftTargetArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("MCLeftTargetArrow"));
-	LeftTargetArrow->ArrowSize = 0.1;
-	LeftTargetArrow->SetupAttachment(MCLeft);
-	RightTargetArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("MCRightTargetArrow"));
-	RightTargetArrow->ArrowSize = 0.1;
-	RightTargetArrow->SetupAttachment(MCRight);
-
-	// PID params
-	PGain = 700.0f;
-	IGain = 0.0f;
-	DGain = 50.0f;
-	MaxOutput = 350000.0f;
-	RotationBoost = 12000.f;
-
-	// Init rotation offset
-	LeftHandRotationOffset = FQuat::Identity;
-	RightHandRotationOffset = FQuat::Identity;
-
-	// Init TextComponent
-	TextComponent = CreateDefaultSubobject<UTextRenderComponent>(TEXT("TextComponent"));
-	TextComponent->SetupAttachment(CharCamera);
-	TextComponent->SetRelativeLocationAndRotation(FVector(20, 0, 7), FRotator(180, 0, 0));
-	TextComponent->SetText(FText::FromString("Current Grasp"));
-	TextComponent->SetHorizontalAlignment(EHorizTextAligment::EHTA_Center);
-	TextComponent->SetTextRenderColor(FColor::Black);
-	TextComponent->SetXScale(0.1f);
-	TextComponent->SetYScale(0.1f);
-	TextComponent->SetWorldSize(10.0f);
-
-
-	bShowUserInterface = false;
-}
-
-// Called when the game starts or when spawned
-void AMCCharacter::BeginPlay()
-{
-	Super::BeginPlay();
-
-	// Set target arrow visibility at runtime
-	LeftTargetArrow->SetHiddenInGame(!bShowTargetArrows);
-	RightTargetArrow->SetHiddenInGame(!bShowTargetArrows);
-
-	// Set the hand PID controller values
-	LeftPIDController.SetValues(PGain, IGain, DGain, MaxOutput, -MaxOutput);
-	RightPIDController.SetValues(PGain, IGain, DGain, MaxOutput, -MaxOutput);
-
-	// Check if VR is enabled
-	if (GEngine && GEngine->XRSystem.IsValid()) {
-		IHeadMountedDisplay* HMD = static_cast<IHeadMountedDisplay*>(GEngine->XRSystem->GetHMDDevice());
-		if (HMD && HMD->IsHMDEnabled())
-		{
-			// VR MODE
-			//CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, -GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
-		}
-		else
-		{
-			GetCapsuleComponent()->SetCollisionProfileName(TEXT("Pawn"));
-			CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, BaseEyeHeight));
-			CharCamera->bUsePawnControlRotation = true;
-			MCOriginComponent->SetRelativeLocation(FVector(0.f, 0.f, 0.f));
-			MCLeft->SetRelativeLocation(FVector(75.f, -30.f, 30.f));
-			MCRight->SetRelativeLocation(FVector(75.f, 30.f, 30.f));
-		}
-	}
-
-	if (LeftSkelActor)
-	{
-		// Cast the hands to AHand
-		LeftHand = Cast<AHand>(LeftSkelActor);
-
-		// Set hand offsets
-		if (bUseHandsInitialRotationAsOffset)
-		{
-			LeftHandRotationOffset = LeftSkelActor->GetSkeletalMeshComponent()->GetComponentQuat();
-		}
-
-		// Teleport hands to the current position of the motion controllers
-		LeftSkelActor->SetActorLocationAndRotation(MCLeft->GetComponentLocation(),
-			MCLeft->GetComponentQuat() * LeftHandRotationOffset,
-			false, static_cast<FHitResult*>(nullptr), ETeleportType::TeleportPhysics);
-	}
-
-	if (RightSkelActor)
-	{
-		// Cast the hands to AHand
-		RightHand = Cast<AHand>(RightSkelActor);
-
-		// Set hand offsets
-		if (bUseHandsInitialRotationAsOffset)
-		{
-			RightHandRotationOffset = RightSkelActor->GetSkeletalMeshComponent()->GetComponentQuat();
-		}
-
-		// Teleport hands to the current position of the motion controllers
-		RightSkelActor->SetActorLocationAndRotation(MCRight->GetComponentLocation(),
-			MCRight->GetComponentQuat() * RightHandRotationOffset,
-			false, static_cast<FHitResult*>(nullptr), ETeleportType::TeleportPhysics);
-	}
-
-	// If two hands are available, let them know about each other (for two hands fixation grasp)
-	bTryTwoHandsFixationGrasp = (bTryTwoHandsFixationGrasp && LeftHand && RightHand);
-	if (bTryTwoHandsFixationGrasp)
-	{
-		LeftHand->SetOtherHand(RightHand);
-		RightHand->SetOtherHand(LeftHand);
-	}
-
-	// Initialize UserInterface
-	UserInterface = CreateWidget<UGraspTypeWidget>(GetWorld(), UGraspTypeWidget::StaticClass());
-	if (UserInterface) UserInterface->SetupWidget(this);
-
-	// Currently used as VR 3D Widget
-	//
-	//FStringClassReference HandForceWidgetClassRef(TEXT("/Game/Widget/WB_HandForce.WB_HandForce_C"));
-	//if (UClass* HandForceClass = HandForceWidgetClassRef.TryLoadClass<UUserWidget>())
-	//{
-	//	UUserWidget* HandForceWidget = CreateWidget<UUserWidget>(GetWorld(), HandForceClass);
-	//	HandForceWidget->AddToViewport(10);
-	//}
-}
-
-// Called every frame
-void AMCCharacter::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	// Force based movement of the hands to target location and rotation
-	if (LeftSkelActor)
-	{
-		AMCCharacter::UpdateHandLocationAndRotation(
-			MCLeft, LeftHandRotationOffset, LeftSkelActor->GetSkeletalMeshComponent(), LeftPIDController, DeltaTime);
-	}
-	if (RightSkelActor)
-	{
-		AMCCharacter::UpdateHandLocationAndRotation(
-			MCRight, RightHandRotationOffset, RightSkelActor->GetSkeletalMeshComponent(), RightPIDController, DeltaTime);
-	}
-}
-
-// Called to bind functionality to input
-void AMCCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
-{
-	Super::SetupPlayerInputComponent(PlayerInputComponent);
-
-	if (IsRootComponentMovable())
-	{
-		// Set up gameplay key bindings
-		PlayerInputComponent->BindAxis("MoveForward", this, &AMCCharacter::MoveForward);
-		PlayerInputComponent->BindAxis("MoveRight", this, &AMCCharacter::MoveRight);
-		PlayerInputComponent->BindAxis("MoveHandsOnZ", this, &AMCCharacter::MoveHandsOnZ);
-		// Default Camera view bindings
-		PlayerInputComponent->BindAxis("CameraPitch", this, &AMCCharacter::AddControllerPitchInput);
-		PlayerInputComponent->BindAxis("CameraYaw", this, &AMCCharacter::AddControllerYawInput);
-	}
-
-	// Hand control binding
-	PlayerInputComponent->BindAxis("GraspWithLeftHand", this, &AMCCharacter::GraspWithLeftHand);
-	PlayerInputComponent->BindAxis("GraspWithRightHand", this, &AMCCharacter::GraspWithRightHand);
-
-	PlayerInputComponent->BindAction("SwitchGraspType", IE_Pressed, this, &AMCCharacter::ToggleUserInterface);
-	PlayerInputComponent->BindAction("NextGraspType", IE_Pressed, this, &AMCCharacter::SwitchToNextGraspType);
-	PlayerInputComponent->BindAction("PreviousGraspType", IE_Pressed, this, &AMCCharacter::SwitchToPreviousGraspType);
-	PlayerInputComponent->BindAction("SwitchGraspProcess", IE_Pressed, this, &AMCCharacter::SwitchGraspProcess);
-
-	// Hand action binding
-	PlayerInputComponent->BindAction("AttachToLeftHand", IE_Pressed, this, &AMCCharacter::TryLeftFixationGrasp);
-	PlayerInputComponent->BindAction("AttachToRightHand", IE_Pressed, this, &AMCCharacter::TryRightFixationGrasp);
-	PlayerInputComponent->BindAction("AttachToLeftHand", IE_Released, this, &AMCCharacter::TryLeftGraspDetach);
-	PlayerInputComponent->BindAction("AttachToRightHand", IE_Released, this, &AMCCharacter::TryRightGraspDetach);
-
-	PlayerInputComponent->BindAction("WI_MouseButton", IE_Released, this, &AMCCharacter::SimulateMouseClick); 
-}
-
-// Handles moving forward/backward
-void AMCCharacter::MoveForward(const float Value)
-{
-	if ((Controller != nullptr) && (Value != 0.0f))
-	{
-		// find out which way is forward
-		FRotator Rotation = Controller->GetControlRotation();
-		// Limit pitch when walking or falling
-		if (GetCharacterMovement()->IsMovingOnGround() || GetCharacterMovement()->IsFalling())
-		{
-			Rotation.Pitch = 0.0f;
-		}
-		// add movement in that direction
-		const FVector Direction = FRotationMatrix(Rotation).GetScaledAxis(EAxis::X);
-		AddMovementInput(Direction, Value);
-	}
-}
-
-// Handles moving right/left
-void AMCCharacter::MoveRight(const float Value)
-{
-	if ((Controller != nullptr) && (Value != 0.0f))
-	{
-		// find out which way is right
-		const FRotator Rotation = Controller->GetControlRotation();
-		const FVector Direction = FRotationMatrix(Rotation).GetScaledAxis(EAxis::Y);
-		// add movement in that direction
-		AddMovementInput(Direction, Value);
-	}
-}
-
-// Move hands when not in VR up and down
-void AMCCharacter::MoveHandsOnZ(const float Value)
-{
-	if (Value != 0)
-	{
-		// Check if VR is enabled
-		IHeadMountedDisplay* HMD = static_cast<IHeadMountedDisplay*>(GEngine->XRSystem->GetHMDDevice());
-		if (HMD && HMD->IsHMDEnabled())
-		{
-			MCLeft->AddLocalOffset(FVector(0.f, 0.f, Value));
-			MCRight->AddLocalOffset(FVector(0.f, 0.f, Value));
-		}
-
-	}
-}
-
-// Update hand positions
-FORCEINLINE void AMCCharacter::UpdateHandLocationAndRotation(
-	UMotionControllerComponent* MC,
-	const FQuat& RotOffset,
-	USkeletalMeshComponent* SkelMesh,
-	PIDController3D& PIDController,
-	const float DeltaTime)
-{
-	//// Location
-	const FVector Error = MC->GetComponentLocation() - SkelMesh->GetComponentLocation();
-	const FVector LocOutput = PIDController.UpdateAsPD(Error, DeltaTime);
-	SkelMesh->AddForceToAllBodiesBelow(LocOutput, NAME_None, true, true);
-	//// Velocity based control
-	//const FVector LocOutput = PIDController.UpdateAsP(Error, DeltaTime);
-	//SkelMesh->SetAllPhysicsLinearVelocity(LocOutput);
-
-	//// Rotation
-	const FQuat TargetQuat = MC->GetComponentQuat() * RotOffset;
-	FQuat CurrQuat = SkelMesh->GetComponentQuat();
-
-	// Dot product to get cos theta
-	const float CosTheta = TargetQuat | CurrQuat;
-	// Avoid taking the long path around the sphere
-	if (CosTheta < 0)
-	{
-		CurrQuat *= -1.f;
-	}
-	// Use the xyz part of the quat as the rotation velocity
-	const FQuat OutputFromQuat = TargetQuat * CurrQuat.Inverse();
-	const FVector RotOutput = FVector(OutputFromQuat.X, OutputFromQuat.Y, OutputFromQuat.Z) * RotationBoost;
-	SkelMesh->SetAllPhysicsAngularVelocity(RotOutput);
-}
-
-
-// Switch to the last grasping type
-void AMCCharacter::SwitchToPreviousGraspType()
-{
-	FText GraspTypeName = FText::FromName("");
-	
-	if (RightHand)
-	{
-		RightHand->SwitchToPreviousGraspType(GraspTypeName);
-	}
-
-	if (LeftHand)
-	{
-		LeftHand->SwitchToPreviousGraspType(GraspTypeName);
-	}
-
-	TextComponent->SetText(GraspTypeName);
-
-}
-
-// Switch to the next grasping type
-void AMCCharacter::SwitchToNextGraspType()
-{
-	FText GraspTypeName = FText::FromName("");
-
-	if (RightHand)
-	{
-		RightHand->SwitchToNextGraspType(GraspTypeName);
-	}
-
-	if (LeftHand)
-	{
-		LeftHand->SwitchToNextGraspType(GraspTypeName);
-	}
-
-	TextComponent->SetText(GraspTypeName);
-}
-
-// Switch Grasp style
-void AMCCharacter::SwitchGraspType(EGraspType GraspType)
-{
-	if (RightHand)
-	{
-		RightHand->SwitchGraspType(GraspType);
-	}
-
-	if (LeftHand)
-	{
-		LeftHand->SwitchGraspType(GraspType);
-	}
-}
-
-// Switch Grasp process
-void AMCCharacter::SwitchGraspProcess()
-{
-	if (RightHand)
-	{
-		RightHand->SwitchGraspProcess();
-	}
-
-	if (LeftHand)
-	{
-		LeftHand->SwitchGraspProcess();
-	}
-}
-
-// Update left hand grasp
-void AMCCharacter::GraspWithLeftHand(const float Val)
-{
-	if (LeftHand)
-	{
-		//LeftHand->UpdateGrasp(Val);
-		// For the realisitc grasping part
-		LeftHand->UpdateGrasp2(Val);
-	}
-}
-
-// Update right hand grasp
-void AMCCharacter::GraspWithRightHand(const float Val)
-{
-	if (RightHand)
-	{
-		//RightHand->UpdateGrasp(Val);
-		// For the realisitc grasping part
-		RightHand->UpdateGrasp2(Val);
-	}
-}
-
-// Attach to left hand
-void AMCCharacter::TryLeftFixationGrasp()
-{
-	if (bTryFixationGrasp && LeftHand)
-	{
-		// If one hand attachment is not possible, check for two hands
-		if (!LeftHand->TryOneHandFixationGrasp())
-		{
-			// If other hand is set and two hand grasp is enabled
-			if (bTryTwoHandsFixationGrasp && RightHand)
-			{
-				// Try grasping with two hands
-				LeftHand->TryTwoHandsFixationGrasp();
-			}
-		}
-	}
-}
-
-// Attach to right hand
-void AMCCharacter::TryRightFixationGrasp()
-{
-	if (bTryFixationGrasp && RightHand)
-	{
-		// If one hand attachment is not possible, check for two hands
-		if (!RightHand->TryOneHandFixationGrasp())
-		{
-			if (bTryTwoHandsFixationGrasp && LeftHand)
-			{
-				// Check if two hand fixation is possible
-				RightHand->TryTwoHandsFixationGrasp();
-			}
-		}
-	}
-}
-
-// Detach from left hand
-void AMCCharacter::TryLeftGraspDetach()
-{
-	if (LeftHand)
-	{
-		LeftHand->DetachFixationGrasp();
-	}
-}
-
-// Detach from right hand
-void AMCCharacter::TryRightGraspDetach()
-{
-	if (RightHand)
-	{
-		RightHand->DetachFixationGrasp();
-	}
-}
-
-
-//Toggle the User Interface
-void AMCCharacter::ToggleUserInterface()
-{
-	if (bShowUserInterface == false)
-	{
-		bShowUserInterface = true;
-
-		UserInterface = CreateWidget<UGraspTypeWidget>(GetWorld(), UGraspTypeWidget::StaticClass());
-		if (!UserInterface)
-				return;
-		UserInterface->SetupWidget(this);
-		UserInterface->AddToViewport();
-
-		// Focus on list and activate cursor
-		FInputModeGameAndUI Mode;
-		Mode.SetLockMouseToViewportBehavior(EMouseLockMode::LockAlways);
-		Mode.SetHideCursorDuringCapture(false);
-		GetWorld()->GetFirstPlayerController()->SetInputMode(Mode);
-		GetWorld()->GetFirstPlayerController()->bShowMouseCursor = true;
-
-		UE_LOG(LogTemp, Warning, TEXT("Add User Interface"));
-	}
-	else
-	{
-		UserInterface->ConditionalBeginDestroy();
-		bShowUserInterface = false;
-
-		FInputModeGameOnly Mode;
-		GetWorld()->GetFirstPlayerController()->SetInputMode(Mode);
-		GetWorld()->GetFirstPlayerController()->bShowMouseCursor = false;
-
-		UE_LOG(LogTemp, Warning, TEXT("Remove User Interface"));
-	}
-}
-
-void AMCCharacter::SimulateMouseClick()
-{
-	WidgetInteractionComponent->PressPointerKey(EKeys::LeftMouseButton);
-	WidgetInteractionComponent->ReleasePointerKey(EKeys::LeftMouseButton);
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+// Author: Andrei Haidu (http://haidu.eu)
+
+#include "MCCharacter.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/ArrowComponent.h"
+#include "Components/InputComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "IHeadMountedDisplay.h"
+#include "Kismet/GameplayStatics.h"
+#include "Runtime/UMG/Public/Blueprint/UserWidget.h"
+#include "Engine/Engine.h"
+#include "IXRTrackingSystem.h"
+#include "Utilities/HandManager.h"
+#include "Paths.h"
+#include "Misc/App.h"
+#include "HAL/PlatformTime.h"
+
+// Sets default values
+AMCCharacter::AMCCharacter()
+{
+	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	PrimaryActorTick.bCanEverTick = true;
+	// Set this pawn to be controlled by the lowest-numbered player
+	AutoPossessPlayer = EAutoReceiveInput::Player0;
+	// Make the capsule thin, and set it only to collide with static objects (VR Mode)
+	GetCapsuleComponent()->SetCapsuleRadius(10);
+	GetCapsuleComponent()->SetCollisionProfileName(TEXT("Spectator"));
+
+	// Set flag default values
+	bShowTargetArrows = true;
+	bUseHandsInitialRotationAsOffset = true;
+	bTryFixationGrasp = true;
+	bTryTwoHandsFixationGrasp = true;
+
+	// Create the motion controller offset (hands in front of the character), attach to root component
+	MCOriginComponent = CreateDefaultSubobject<USceneComponent>(TEXT("MCOriginComponent"));
+	MCOriginComponent->SetupAttachment(GetRootComponent());
+	MCOriginComponent->SetRelativeLocation(FVector(0.0f, 0.0f, -GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
+
+	// Create a CameraComponent, attach to capsule
+	CharCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("MCCharacterCamera"));
+	CharCamera->SetupAttachment(MCOriginComponent);
+	// Default camera for VR use -- relative location at the floor 
+	//CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, -GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
+	//CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, BaseEyeHeight));
+
+	WidgetInteractionComponent = CreateDefaultSubobject<UWidgetInteractionComponent>(TEXT("WindgetInteractionComponent"));
+	WidgetInteractionComponent->SetupAttachment(CharCamera);
+
+	// Create left/right motion controller
+	MCLeft = CreateDefaultSubobject<UMotionControllerComponent>(TEXT("MCLeft"));
+	MCLeft->SetupAttachment(MCOriginComponent);
+	MCLeft->Hand = EControllerHand::Left;
+	MCRight = CreateDefaultSubobject<UMotionControllerComponent>(TEXT("MCRight"));
+	MCRight->SetupAttachment(MCOriginComponent);
+	MCRight->Hand = EControllerHand::Right;
+
+	// Create left/right target vis arrows, attached to the MC
+	LeftTargetArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("MCLeftTargetArrow"));
+	LeftTargetArrow->ArrowSize = 0.1;
+	LeftTargetArrow->SetupAttachment(MCLeft);
+	RightTargetArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("MCRightTargetArrow"));
+	RightTargetArrow->ArrowSize = 0.1;
+	RightTargetArrow->SetupAttachment(MCRight);
+
+	// PID params
+	PGain = 700.0f;
+	IGain = 0.0f;
+	DGain = 50.0f;
+	MaxOutput = 350000.0f;
+	RotationBoost = 12000.f;
+	bTrackRootBodyOnly = true;
+
+	// Prediction params, about one physics frame ahead
+	bPredictMotionControllerPose = false;
+	PredictionHorizon = 0.011f;
+	bShowPredictionError = false;
+
+	// Hands are set at begin play
+	LeftHand = nullptr;
+	RightHand = nullptr;
+
+	// Latency measurement default values
+	bMeasureLatency = true;
+	LatencyPoseDistance = 2.0f;
+	LatencyPoseTolerance = 0.5f;
+	LatencyTriggerThreshold = 0.1f;
+	LatencyContactGripForce = 500.0f;
+	LatencyProbeTimeout = 1.0f;
+
+	// Input recording default values
+	bRecordInput = false;
+	bReplayInput = false;
+	InputRecordingFile = TEXT("MCInputRecording.bin");
+	ReplayTimestep = 1.0f / 90.0f;
+	bPrevUseFixedTimeStep = false;
+	PrevFixedDeltaTime = 0.0;
+
+	// Hand masses are set at begin play
+	LeftHandMass = 0.0f;
+	RightHandMass = 0.0f;
+
+	// Init rotation offset
+	LeftHandRotationOffset = FQuat::Identity;
+	RightHandRotationOffset = FQuat::Identity;
+
+	// Init TextComponent
+	TextComponent = CreateDefaultSubobject<UTextRenderComponent>(TEXT("TextComponent"));
+	TextComponent->SetupAttachment(CharCamera);
+	TextComponent->SetRelativeLocationAndRotation(FVector(20, 0, 7), FRotator(180, 0, 0));
+	TextComponent->SetText(FText::FromString("Current Grasp"));
+	TextComponent->SetHorizontalAlignment(EHorizTextAligment::EHTA_Center);
+	TextComponent->SetTextRenderColor(FColor::Black);
+	TextComponent->SetXScale(0.1f);
+	TextComponent->SetYScale(0.1f);
+	TextComponent->SetWorldSize(10.0f);
+
+
+	bShowUserInterface = false;
+}
+
+// Called when the game starts or when spawned
+void AMCCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Set target arrow visibility at runtime
+	LeftTargetArrow->SetHiddenInGame(!bShowTargetArrows);
+	RightTargetArrow->SetHiddenInGame(!bShowTargetArrows);
+
+	// Set the hand PID controller values
+	LeftPIDController.SetValues(PGain, IGain, DGain, MaxOutput, -MaxOutput);
+	RightPIDController.SetValues(PGain, IGain, DGain, MaxOutput, -MaxOutput);
+
+	// Check if VR is enabled
+	if (GEngine && GEngine->XRSystem.IsValid()) {
+		IHeadMountedDisplay* HMD = static_cast<IHeadMountedDisplay*>(GEngine->XRSystem->GetHMDDevice());
+		if (HMD && HMD->IsHMDEnabled())
+		{
+			// VR MODE
+			//CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, -GetCapsuleComponent()->GetScaledCapsuleHalfHeight()));
+		}
+		else
+		{
+			GetCapsuleComponent()->SetCollisionProfileName(TEXT("Pawn"));
+			CharCamera->SetRelativeLocation(FVector(0.0f, 0.0f, BaseEyeHeight));
+			CharCamera->bUsePawnControlRotation = true;
+			MCOriginComponent->SetRelativeLocation(FVector(0.f, 0.f, 0.f));
+			MCLeft->SetRelativeLocation(FVector(75.f, -30.f, 30.f));
+			MCRight->SetRelativeLocation(FVector(75.f, 30.f, 30.f));
+		}
+	}
+
+	// Replay the recorded input with a fixed timestep instead of the motion controllers and the user input
+	if (bReplayInput)
+	{
+		if (InputRecording.LoadFromFile(FPaths::ProjectSavedDir() + InputRecordingFile) && InputRecording.GetNumFrames() > 0)
+		{
+			DisableInput(nullptr);
+			MCLeft->SetComponentTickEnabled(false);
+			MCRight->SetComponentTickEnabled(false);
+
+			bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+			PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+			FApp::SetUseFixedTimeStep(true);
+			FApp::SetFixedDeltaTime(ReplayTimestep);
+
+			// Start the hands at the first recorded pose
+			const FMCInputFrame& FirstFrame = InputRecording.GetFrame(0);
+			MCLeft->SetWorldLocationAndRotation(FirstFrame.LeftLocation, FirstFrame.LeftRotation);
+			MCRight->SetWorldLocationAndRotation(FirstFrame.RightLocation, FirstFrame.RightRotation);
+		}
+		else
+		{
+			bReplayInput = false;
+		}
+	}
+
+	if (LeftSkelActor)
+	{
+		// Cast the hands to AHand
+		LeftHand = Cast<AHand>(LeftSkelActor);
+		LeftHandMass = LeftSkelActor->GetSkeletalMeshComponent()->GetMass();
+
+		// Set hand offsets
+		if (bUseHandsInitialRotationAsOffset)
+		{
+			LeftHandRotationOffset = LeftSkelActor->GetSkeletalMeshComponent()->GetComponentQuat();
+		}
+
+		// Teleport hands to the current position of the motion controllers
+		LeftSkelActor->SetActorLocationAndRotation(MCLeft->GetComponentLocation(),
+			MCLeft->GetComponentQuat() * LeftHandRotationOffset,
+			false, static_cast<FHitResult*>(nullptr), ETeleportType::TeleportPhysics);
+	}
+
+	if (RightSkelActor)
+	{
+		// Cast the hands to AHand
+		RightHand = Cast<AHand>(RightSkelActor);
+		RightHandMass = RightSkelActor->GetSkeletalMeshComponent()->GetMass();
+
+		// Set hand offsets
+		if (bUseHandsInitialRotationAsOffset)
+		{
+			RightHandRotationOffset = RightSkelActor->GetSkeletalMeshComponent()->GetComponentQuat();
+		}
+
+		// Teleport hands to the current position of the motion controllers
+		RightSkelActor->SetActorLocationAndRotation(MCRight->GetComponentLocation(),
+			MCRight->GetComponentQuat() * RightHandRotationOffset,
+			false, static_cast<FHitResult*>(nullptr), ETeleportType::TeleportPhysics);
+	}
+
+	// The hands are moved by their own controllers, set the gains of the character
+	if (LeftHand)
+	{
+		LeftHand->SetTrackingController(PGain, IGain, DGain, MaxOutput, RotationBoost);
+	}
+	if (RightHand)
+	{
+		RightHand->SetTrackingController(PGain, IGain, DGain, MaxOutput, RotationBoost);
+	}
+
+	// Latency of this session
+	if (bMeasureLatency)
+	{
+		HandLatencyStats::Reset();
+	}
+
+	// Update the hands after the character has set the tracking targets,
+	// the hands placed in the level have no owner, so the character orders the hands ticking on their own as well
+	AHandManager* const HandManager = AHandManager::Get(GetWorld());
+	if (HandManager)
+	{
+		HandManager->AddTickPrerequisiteActor(this);
+	}
+	if (LeftHand)
+	{
+		LeftHand->AddTickPrerequisiteActor(this);
+	}
+	if (RightHand)
+	{
+		RightHand->AddTickPrerequisiteActor(this);
+	}
+
+	// If two hands are available, let them know about each other (for two hands fixation grasp)
+	bTryTwoHandsFixationGrasp = (bTryTwoHandsFixationGrasp && LeftHand && RightHand);
+	if (bTryTwoHandsFixationGrasp)
+	{
+		LeftHand->SetOtherHand(RightHand);
+		RightHand->SetOtherHand(LeftHand);
+	}
+
+	// Initialize UserInterface
+	UserInterface = CreateWidget<UGraspTypeWidget>(GetWorld(), UGraspTypeWidget::StaticClass());
+	if (UserInterface) UserInterface->SetupWidget(this);
+
+	// Currently used as VR 3D Widget
+	//
+	//FStringClassReference HandForceWidgetClassRef(TEXT("/Game/Widget/WB_HandForce.WB_HandForce_C"));
+	//if (UClass* HandForceClass = HandForceWidgetClassRef.TryLoadClass<UUserWidget>())
+	//{
+	//	UUserWidget* HandForceWidget = CreateWidget<UUserWidget>(GetWorld(), HandForceClass);
+	//	HandForceWidget->AddToViewport(10);
+	//}
+}
+
+// Called when the character is removed from the world
+void AMCCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bMeasureLatency)
+	{
+		HandLatencyStats::LogSession();
+	}
+
+	if (bReplayInput)
+	{
+		FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+	}
+	else if (bRecordInput && InputRecording.GetNumFrames() > 0)
+	{
+		InputRecording.SaveToFile(FPaths::ProjectSavedDir() + InputRecordingFile);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+// Called every frame
+void AMCCharacter::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// The recorded input replaces the motion controllers and the user input
+	if (bReplayInput)
+	{
+		AMCCharacter::ReplayInputFrame();
+	}
+	else if (bRecordInput)
+	{
+		AMCCharacter::RecordInputFrame();
+	}
+
+	// Force based movement of the hands to target location and rotation
+	if (LeftHand)
+	{
+		const FTransform Target = AMCCharacter::GetHandTarget(MCLeft, LeftHandRotationOffset, LeftPosePredictor);
+		LeftHand->SetTrackingTarget(Target);
+		if (bMeasureLatency)
+		{
+			AMCCharacter::UpdateLatencyProbe(LeftLatencyProbe, LeftHand, Target.GetLocation());
+		}
+	}
+	else if (LeftSkelActor)
+	{
+		AMCCharacter::UpdateHandLocationAndRotation(
+			AMCCharacter::GetHandTarget(MCLeft, LeftHandRotationOffset, LeftPosePredictor),
+			LeftSkelActor->GetSkeletalMeshComponent(), LeftHandMass, LeftPIDController, DeltaTime);
+	}
+	if (RightHand)
+	{
+		const FTransform Target = AMCCharacter::GetHandTarget(MCRight, RightHandRotationOffset, RightPosePredictor);
+		RightHand->SetTrackingTarget(Target);
+		if (bMeasureLatency)
+		{
+			AMCCharacter::UpdateLatencyProbe(RightLatencyProbe, RightHand, Target.GetLocation());
+		}
+	}
+	else if (RightSkelActor)
+	{
+		AMCCharacter::UpdateHandLocationAndRotation(
+			AMCCharacter::GetHandTarget(MCRight, RightHandRotationOffset, RightPosePredictor),
+			RightSkelActor->GetSkeletalMeshComponent(), RightHandMass, RightPIDController, DeltaTime);
+	}
+
+	if (bMeasureLatency)
+	{
+		HandLatencyStats::UpdateStats();
+	}
+
+	if (bPredictMotionControllerPose && bShowPredictionError && GEngine)
+	{
+		const FPosePredictionStats& LeftStats = LeftPosePredictor.GetStats();
+		const FPosePredictionStats& RightStats = RightPosePredictor.GetStats();
+		GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, FString::Printf(
+			TEXT("MC prediction error L: %.2f cm (max %.2f) %.2f deg (max %.2f) | R: %.2f cm (max %.2f) %.2f deg (max %.2f)"),
+			LeftStats.MeanLocationError, LeftStats.MaxLocationError, LeftStats.MeanRotationError, LeftStats.MaxRotationError,
+			RightStats.MeanLocationError, RightStats.MaxLocationError, RightStats.MeanRotationError, RightStats.MaxRotationError));
+	}
+}
+
+// Called to bind functionality to input
+void AMCCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
+{
+	Super::SetupPlayerInputComponent(PlayerInputComponent);
+
+	if (IsRootComponentMovable())
+	{
+		// Set up gameplay key bindings
+		PlayerInputComponent->BindAxis("MoveForward", this, &AMCCharacter::MoveForward);
+		PlayerInputComponent->BindAxis("MoveRight", this, &AMCCharacter::MoveRight);
+		PlayerInputComponent->BindAxis("MoveHandsOnZ", this, &AMCCharacter::MoveHandsOnZ);
+		// Default Camera view bindings
+		PlayerInputComponent->BindAxis("CameraPitch", this, &AMCCharacter::AddControllerPitchInput);
+		PlayerInputComponent->BindAxis("CameraYaw", this, &AMCCharacter::AddControllerYawInput);
+	}
+
+	// Hand control binding
+	PlayerInputComponent->BindAxis("GraspWithLeftHand", this, &AMCCharacter::GraspWithLeftHand);
+	PlayerInputComponent->BindAxis("GraspWithRightHand", this, &AMCCharacter::GraspWithRightHand);
+
+	PlayerInputComponent->BindAction("SwitchGraspType", IE_Pressed, this, &AMCCharacter::ToggleUserInterface);
+	PlayerInputComponent->BindAction("NextGraspType", IE_Pressed, this, &AMCCharacter::SwitchToNextGraspType);
+	PlayerInputComponent->BindAction("PreviousGraspType", IE_Pressed, this, &AMCCharacter::SwitchToPreviousGraspType);
+	PlayerInputComponent->BindAction("SwitchGraspProcess", IE_Pressed, this, &AMCCharacter::SwitchGraspProcess);
+
+	// Hand action binding
+	PlayerInputComponent->BindAction("AttachToLeftHand", IE_Pressed, this, &AMCCharacter::TryLeftFixationGrasp);
+	PlayerInputComponent->BindAction("AttachToRightHand", IE_Pressed, this, &AMCCharacter::TryRightFixationGrasp);
+	PlayerInputComponent->BindAction("AttachToLeftHand", IE_Released, this, &AMCCharacter::TryLeftGraspDetach);
+	PlayerInputComponent->BindAction("AttachToRightHand", IE_Released, this, &AMCCharacter::TryRightGraspDetach);
+
+	PlayerInputComponent->BindAction("WI_MouseButton", IE_Released, this, &AMCCharacter::SimulateMouseClick); 
+}
+
+// Handles moving forward/backward
+void AMCCharacter::MoveForward(const float Value)
+{
+	if ((Controller != nullptr) && (Value != 0.0f))
+	{
+		// find out which way is forward
+		FRotator Rotation = Controller->GetControlRotation();
+		// Limit pitch when walking or falling
+		if (GetCharacterMovement()->IsMovingOnGround() || GetCharacterMovement()->IsFalling())
+		{
+			Rotation.Pitch = 0.0f;
+		}
+		// add movement in that direction
+		const FVector Direction = FRotationMatrix(Rotation).GetScaledAxis(EAxis::X);
+		AddMovementInput(Direction, Value);
+	}
+}
+
+// Handles moving right/left
+void AMCCharacter::MoveRight(const float Value)
+{
+	if ((Controller != nullptr) && (Value != 0.0f))
+	{
+		// find out which way is right
+		const FRotator Rotation = Controller->GetControlRotation();
+		const FVector Direction = FRotationMatrix(Rotation).GetScaledAxis(EAxis::Y);
+		// add movement in that direction
+		AddMovementInput(Direction, Value);
+	}
+}
+
+// Move hands when not in VR up and down
+void AMCCharacter::MoveHandsOnZ(const float Value)
+{
+	if (Value != 0)
+	{
+		// Check if VR is enabled
+		IHeadMountedDisplay* HMD = static_cast<IHeadMountedDisplay*>(GEngine->XRSystem->GetHMDDevice());
+		if (HMD && HMD->IsHMDEnabled())
+		{
+			MCLeft->AddLocalOffset(FVector(0.f, 0.f, Value));
+			MCRight->AddLocalOffset(FVector(0.f, 0.f, Value));
+		}
+
+	}
+}
+
+// Get the hand target of the motion controller, predicted if enabled
+FTransform AMCCharacter::GetHandTarget(
+	UMotionControllerComponent* MC,
+	const FQuat& RotOffset,
+	PosePredictor& Predictor)
+{
+	const FTransform Target(MC->GetComponentQuat() * RotOffset, MC->GetComponentLocation());
+	if (!bPredictMotionControllerPose)
+	{
+		return Target;
+	}
+
+	// The sampled pose is already late when physics reaches it, move the hand to where the controller will be,
+	// the controller moves in real time, independent of time dilation and pause
+	Predictor.AddSample(Target, GetWorld()->GetRealTimeSeconds());
+	return Predictor.Predict(PredictionHorizon);
+}
+
+// Update hand positions
+FORCEINLINE void AMCCharacter::UpdateHandLocationAndRotation(
+	const FTransform& Target,
+	USkeletalMeshComponent* SkelMesh,
+	const float HandMass,
+	PIDController3D& PIDController,
+	const float DeltaTime)
+{
+	// Only the root body is driven, the rest of the hand follows through the joints
+	FBodyInstance* const RootBody = bTrackRootBodyOnly ? SkelMesh->GetBodyInstance() : nullptr;
+
+	//// Location
+	const FVector Error = Target.GetLocation() - SkelMesh->GetComponentLocation();
+	const FVector LocOutput = PIDController.UpdateAsPD(Error, DeltaTime);
+	if (RootBody)
+	{
+		RootBody->AddForce(LocOutput * HandMass, true, false);
+	}
+	else
+	{
+		SkelMesh->AddForceToAllBodiesBelow(LocOutput, NAME_None, true, true);
+	}
+	//// Velocity based control
+	//const FVector LocOutput = PIDController.UpdateAsP(Error, DeltaTime);
+	//SkelMesh->SetAllPhysicsLinearVelocity(LocOutput);
+
+	//// Rotation
+	const FQuat TargetQuat = Target.GetRotation();
+	FQuat CurrQuat = SkelMesh->GetComponentQuat();
+
+	// Dot product to get cos theta
+	const float CosTheta = TargetQuat | CurrQuat;
+	// Avoid taking the long path around the sphere
+	if (CosTheta < 0)
+	{
+		CurrQuat *= -1.f;
+	}
+	// Use the xyz part of the quat as the rotation velocity
+	const FQuat OutputFromQuat = TargetQuat * CurrQuat.Inverse();
+	const FVector RotOutput = FVector(OutputFromQuat.X, OutputFromQuat.Y, OutputFromQuat.Z) * RotationBoost;
+	if (RootBody)
+	{
+		RootBody->SetAngularVelocityInRadians(FMath::DegreesToRadians(RotOutput), false);
+	}
+	else
+	{
+		SkelMesh->SetAllPhysicsAngularVelocity(RotOutput);
+	}
+}
+
+
+// Update the latency measurements of the hand with the tracking target of this tick
+void AMCCharacter::UpdateLatencyProbe(FHandLatencyProbe& Probe, const AHand* const Hand, const FVector& TargetLocation)
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const FVector HandLocation = Hand->GetSkeletalMeshComponent()->GetComponentLocation();
+
+	// Pose probe, started when the target moved away from the target of the last probe
+	if (!Probe.bPoseTargetValid)
+	{
+		Probe.bPoseTargetValid = true;
+		Probe.PoseTarget = TargetLocation;
+	}
+	else if (!Probe.bPoseProbeOpen)
+	{
+		if (FVector::Dist(TargetLocation, Probe.PoseTarget) > LatencyPoseDistance)
+		{
+			Probe.bPoseProbeOpen = true;
+			Probe.bPoseCommitted = false;
+			Probe.PoseInputCycles = NowCycles;
+			Probe.PoseStart = HandLocation;
+			Probe.PoseTarget = TargetLocation;
+		}
+	}
+	else
+	{
+		const uint64 CommitCycles = Hand->GetLastTrackingCommitCycles();
+		if (!Probe.bPoseCommitted && CommitCycles > Probe.PoseInputCycles)
+		{
+			Probe.bPoseCommitted = true;
+			HandLatencyStats::PoseToPhysics.AddSample(HandLatencyStats::CyclesToMilliseconds(Probe.PoseInputCycles, CommitCycles));
+		}
+
+		// The target is reached when the hand covered the way to it, it may pass the target following the next ones
+		const FVector Way = Probe.PoseTarget - Probe.PoseStart;
+		const float WayLength = Way.Size();
+		const float Covered = WayLength > KINDA_SMALL_NUMBER ? ((HandLocation - Probe.PoseStart) | Way) / WayLength : WayLength;
+		const float Latency = HandLatencyStats::CyclesToMilliseconds(Probe.PoseInputCycles, NowCycles);
+		if (Covered >= WayLength - LatencyPoseTolerance)
+		{
+			HandLatencyStats::PoseToConvergence.AddSample(Latency);
+			Probe.bPoseProbeOpen = false;
+		}
+		else if (Latency > LatencyProbeTimeout * 1000.0f)
+		{
+			Probe.bPoseProbeOpen = false;
+		}
+	}
+
+	// Grasp probe, started by the trigger press
+	if (Probe.bGraspProbeOpen)
+	{
+		const uint64 CommitCycles = Hand->GetLastGraspCommitCycles();
+		if (!Probe.bGraspCommitted && CommitCycles > Probe.GraspInputCycles)
+		{
+			Probe.bGraspCommitted = true;
+			HandLatencyStats::TriggerToPhysics.AddSample(HandLatencyStats::CyclesToMilliseconds(Probe.GraspInputCycles, CommitCycles));
+		}
+
+		// The grip force is the one of the last physics step
+		const float Latency = HandLatencyStats::CyclesToMilliseconds(Probe.GraspInputCycles, NowCycles);
+		if (Hand->GetGripForce() >= LatencyContactGripForce)
+		{
+			HandLatencyStats::TriggerToContact.AddSample(Latency);
+			Probe.bGraspProbeOpen = false;
+		}
+		else if (Latency > LatencyProbeTimeout * 1000.0f)
+		{
+			Probe.bGraspProbeOpen = false;
+		}
+	}
+}
+
+// Start or stop the trigger latency measurement with the grasp input
+void AMCCharacter::UpdateTriggerLatencyProbe(FHandLatencyProbe& Probe, const float GraspAxis)
+{
+	if (GraspAxis > LatencyTriggerThreshold && Probe.LastGraspAxis <= LatencyTriggerThreshold)
+	{
+		Probe.bGraspProbeOpen = true;
+		Probe.bGraspCommitted = false;
+		Probe.GraspInputCycles = FPlatformTime::Cycles64();
+	}
+	else if (GraspAxis <= LatencyTriggerThreshold)
+	{
+		// Released before contact
+		Probe.bGraspProbeOpen = false;
+	}
+	Probe.LastGraspAxis = GraspAxis;
+}
+
+// Add the action to the frame being recorded
+void AMCCharacter::RecordInputAction(const EMCInputAction Action, const uint8 Argument)
+{
+	if (bRecordInput && !bReplayInput)
+	{
+		RecordedFrame.Actions.Emplace(Action, Argument);
+	}
+}
+
+// Record the input of this frame, the grasp axes and actions are set by the input handlers
+void AMCCharacter::RecordInputFrame()
+{
+	RecordedFrame.LeftLocation = MCLeft->GetComponentLocation();
+	RecordedFrame.LeftRotation = MCLeft->GetComponentQuat();
+	RecordedFrame.RightLocation = MCRight->GetComponentLocation();
+	RecordedFrame.RightRotation = MCRight->GetComponentQuat();
+	InputRecording.AddFrame(RecordedFrame, GetWorld()->GetTimeSeconds());
+	RecordedFrame.Actions.Reset();
+}
+
+// Apply the input of the replay for this frame
+void AMCCharacter::ReplayInputFrame()
+{
+	FMCInputFrame Frame;
+	if (!InputRecording.Replay(ReplayTimestep, Frame))
+	{
+		return;
+	}
+
+	MCLeft->SetWorldLocationAndRotation(Frame.LeftLocation, Frame.LeftRotation);
+	MCRight->SetWorldLocationAndRotation(Frame.RightLocation, Frame.RightRotation);
+	AMCCharacter::GraspWithLeftHand(Frame.LeftGraspAxis);
+	AMCCharacter::GraspWithRightHand(Frame.RightGraspAxis);
+	for (const FMCInputActionEvent& Event : Frame.Actions)
+	{
+		AMCCharacter::ReplayInputAction(Event);
+	}
+
+	if (InputRecording.IsReplayFinished())
+	{
+		UE_LOG(LogTemp, Log, TEXT("Input replay finished after %.2f s"), Frame.Time);
+	}
+}
+
+// Trigger a recorded action
+void AMCCharacter::ReplayInputAction(const FMCInputActionEvent& Event)
+{
+	switch (Event.Action)
+	{
+	case EMCInputAction::SwitchGraspType:
+		AMCCharacter::SwitchGraspType(static_cast<EGraspType>(Event.Argument));
+		break;
+	case EMCInputAction::NextGraspType:
+		AMCCharacter::SwitchToNextGraspType();
+		break;
+	case EMCInputAction::PreviousGraspType:
+		AMCCharacter::SwitchToPreviousGraspType();
+		break;
+	case EMCInputAction::SwitchGraspProcess:
+		AMCCharacter::SwitchGraspProcess();
+		break;
+	case EMCInputAction::LeftFixationGrasp:
+		AMCCharacter::TryLeftFixationGrasp();
+		break;
+	case EMCInputAction::RightFixationGrasp:
+		AMCCharacter::TryRightFixationGrasp();
+		break;
+	case EMCInputAction::LeftGraspDetach:
+		AMCCharacter::TryLeftGraspDetach();
+		break;
+	case EMCInputAction::RightGraspDetach:
+		AMCCharacter::TryRightGraspDetach();
+		break;
+	}
+}
+
+// Switch to the last grasping type
+void AMCCharacter::SwitchToPreviousGraspType()
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::PreviousGraspType);
+	FText GraspTypeName = FText::FromName("");
+	
+	if (RightHand)
+	{
+		RightHand->SwitchToPreviousGraspType(GraspTypeName);
+	}
+
+	if (LeftHand)
+	{
+		LeftHand->SwitchToPreviousGraspType(GraspTypeName);
+	}
+
+	TextComponent->SetText(GraspTypeName);
+
+}
+
+// Switch to the next grasping type
+void AMCCharacter::SwitchToNextGraspType()
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::NextGraspType);
+	FText GraspTypeName = FText::FromName("");
+
+	if (RightHand)
+	{
+		RightHand->SwitchToNextGraspType(GraspTypeName);
+	}
+
+	if (LeftHand)
+	{
+		LeftHand->SwitchToNextGraspType(GraspTypeName);
+	}
+
+	TextComponent->SetText(GraspTypeName);
+}
+
+// Switch Grasp style
+void AMCCharacter::SwitchGraspType(EGraspType GraspType)
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::SwitchGraspType, static_cast<uint8>(GraspType));
+	if (RightHand)
+	{
+		RightHand->SwitchGraspType(GraspType);
+	}
+
+	if (LeftHand)
+	{
+		LeftHand->SwitchGraspType(GraspType);
+	}
+}
+
+// Switch Grasp process
+void AMCCharacter::SwitchGraspProcess()
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::SwitchGraspProcess);
+	if (RightHand)
+	{
+		RightHand->SwitchGraspProcess();
+	}
+
+	if (LeftHand)
+	{
+		LeftHand->SwitchGraspProcess();
+	}
+}
+
+// Update left hand grasp
+void AMCCharacter::GraspWithLeftHand(const float Val)
+{
+	RecordedFrame.LeftGraspAxis = Val;
+	if (bMeasureLatency)
+	{
+		AMCCharacter::UpdateTriggerLatencyProbe(LeftLatencyProbe, Val);
+	}
+	if (LeftHand)
+	{
+		//LeftHand->UpdateGrasp(Val);
+		// For the realisitc grasping part
+		LeftHand->UpdateGrasp2(Val);
+	}
+}
+
+// Update right hand grasp
+void AMCCharacter::GraspWithRightHand(const float Val)
+{
+	RecordedFrame.RightGraspAxis = Val;
+	if (bMeasureLatency)
+	{
+		AMCCharacter::UpdateTriggerLatencyProbe(RightLatencyProbe, Val);
+	}
+	if (RightHand)
+	{
+		//RightHand->UpdateGrasp(Val);
+		// For the realisitc grasping part
+		RightHand->UpdateGrasp2(Val);
+	}
+}
+
+// Attach to left hand
+void AMCCharacter::TryLeftFixationGrasp()
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::LeftFixationGrasp);
+	if (bTryFixationGrasp && LeftHand)
+	{
+		// If one hand attachment is not possible, check for two hands
+		if (!LeftHand->TryOneHandFixationGrasp())
+		{
+			// If other hand is set and two hand grasp is enabled
+			if (bTryTwoHandsFixationGrasp && RightHand)
+			{
+				// Try grasping with two hands
+				LeftHand->TryTwoHandsFixationGrasp();
+			}
+		}
+	}
+}
+
+// Attach to right hand
+void AMCCharacter::TryRightFixationGrasp()
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::RightFixationGrasp);
+	if (bTryFixationGrasp && RightHand)
+	{
+		// If one hand attachment is not possible, check for two hands
+		if (!RightHand->TryOneHandFixationGrasp())
+		{
+			if (bTryTwoHandsFixationGrasp && LeftHand)
+			{
+				// Check if two hand fixation is possible
+				RightHand->TryTwoHandsFixationGrasp();
+			}
+		}
+	}
+}
+
+// Detach from left hand
+void AMCCharacter::TryLeftGraspDetach()
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::LeftGraspDetach);
+	if (LeftHand)
+	{
+		LeftHand->DetachFixationGrasp();
+	}
+}
+
+// Detach from right hand
+void AMCCharacter::TryRightGraspDetach()
+{
+	AMCCharacter::RecordInputAction(EMCInputAction::RightGraspDetach);
+	if (RightHand)
+	{
+		RightHand->DetachFixationGrasp();
+	}
+}
+
+
+//Toggle the User Interface
+void AMCCharacter::ToggleUserInterface()
+{
+	if (bShowUserInterface == false)
+	{
+		bShowUserInterface = true;
+
+		UserInterface = CreateWidget<UGraspTypeWidget>(GetWorld(), UGraspTypeWidget::StaticClass());
+		if (!UserInterface)
+				return;
+		UserInterface->SetupWidget(this);
+		UserInterface->AddToViewport();
+
+		// Focus on list and activate cursor
+		FInputModeGameAndUI Mode;
+		Mode.SetLockMouseToViewportBehavior(EMouseLockMode::LockAlways);
+		Mode.SetHideCursorDuringCapture(false);
+		GetWorld()->GetFirstPlayerController()->SetInputMode(Mode);
+		GetWorld()->GetFirstPlayerController()->bShowMouseCursor = true;
+
+		UE_LOG(LogTemp, Warning, TEXT("Add User Interface"));
+	}
+	else
+	{
+		UserInterface->ConditionalBeginDestroy();
+		bShowUserInterface = false;
+
+		FInputModeGameOnly Mode;
+		GetWorld()->GetFirstPlayerController()->SetInputMode(Mode);
+		GetWorld()->GetFirstPlayerController()->bShowMouseCursor = false;
+
+		UE_LOG(LogTemp, Warning, TEXT("Remove User Interface"));
+	}
+}
+
+void AMCCharacter::SimulateMouseClick()
+{
+	WidgetInteractionComponent->PressPointerKey(EKeys::LeftMouseButton);
+	WidgetInteractionComponent->ReleasePointerKey(EKeys::LeftMouseButton);
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "HandOrientation.h"
 #include "PhysicsEngine/ConstraintInstance.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "Utilities/PhysicsAssetIndexCache.h"
 
 #include "Finger.generated.h"
 
@@ -69,25 +70,23 @@ struct FFinger
 	//UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Finger")
 	TMap<EFingerPart, FConstraintInstance*> FingerPartToConstraint;
 
-	// Set finger part to constraint from bone names
-	bool SetFingerPartsConstraints(TArray<FConstraintInstance*>& Constraints)
+	// Set finger part to constraint from bone names, indices resolved through the physics asset cache
+	bool SetFingerPartsConstraints(TArray<FConstraintInstance*>& Constraints, const PhysicsAssetIndexCache& IndexCache)
 	{
 		if (Constraints.Num() <= 0)
 			return false;
 		// Iterate the bone names
-		for (const auto& MapItr : FingerPartToBoneName)
+		for (auto& MapItr : FingerPartToBoneName)
 		{
-			// TODO null ptr exception if the names do not match
-			// Check if bone name match with the constraint joint name
-			FConstraintInstance* FingerPartConstraint = *Constraints.FindByPredicate(
-				[&MapItr](FConstraintInstance* ConstrInst)
+			// Check if bone name match with the constraint joint name, the bones of the other hand side are used if the skeleton has only those
+			bool bOtherSide = false;
+			const FName JointName = IndexCache.ResolveJointName(MapItr.Value, bOtherSide);
+			if (bOtherSide)
 			{
-				if (!ConstrInst)
-					return false;
-				
-				return ConstrInst->JointName.ToString() == MapItr.Value;
+				MapItr.Value = JointName.ToString();
 			}
-			);
+			const int32 ConstraintIndex = IndexCache.FindConstraintIndex(JointName);
+			FConstraintInstance* FingerPartConstraint = Constraints.IsValidIndex(ConstraintIndex) ? Constraints[ConstraintIndex] : nullptr;
 			// If constraint has been found, add to map
 			if (FingerPartConstraint)
 			{
@@ -102,19 +101,21 @@ struct FFinger
 		return true;
 	}
 
-	// Set finger part to constraint from bone names
-	bool SetFingerPartsBones(TArray<FBodyInstance*>& Bodies)
+	// Set finger part to bone from bone names, indices resolved through the physics asset cache
+	bool SetFingerPartsBones(TArray<FBodyInstance*>& Bodies, const PhysicsAssetIndexCache& IndexCache)
 	{
 		// Iterate the bone names
-		for (const auto& MapItr : FingerPartToBoneName)
+		for (auto& MapItr : FingerPartToBoneName)
 		{
-			// TODO null ptr exception if the names do not match
-			// Check if bone name match with the constraint joint name
-			FBodyInstance* FingerPartBone = *Bodies.FindByPredicate(
-				[&MapItr](FBodyInstance* BodyInst)
-			{return BodyInst->BodySetup->BoneName.ToString() == MapItr.Value; }
-			);
-			// If constraint has been found, add to map
+			bool bOtherSide = false;
+			const FName BoneName = IndexCache.ResolveBoneName(MapItr.Value, bOtherSide);
+			if (bOtherSide)
+			{
+				MapItr.Value = BoneName.ToString();
+			}
+			const int32 BodyIndex = IndexCache.FindBodyIndex(BoneName);
+			FBodyInstance* FingerPartBone = Bodies.IsValidIndex(BodyIndex) ? Bodies[BodyIndex] : nullptr;
+			// If bone has been found, add to map
 			if (FingerPartBone)
 			{
 				FingerPartToBone.Add(MapItr.Key, FingerPartBone);
@@ -128,6 +129,15 @@ struct FFinger
 		return true;
 	}
 
+	// Set the strength of the constraint drives, the drive mode is kept
+	void SetFingerDriveParams(const float InSpring, const float InDamping, const float InForceLimit)
+	{
+		for (const auto& MapItr : FingerPartToConstraint)
+		{
+			MapItr.Value->SetAngularDriveParams(InSpring, InDamping, InForceLimit);
+		}
+	}
+
 	// Set constraint drive mode
 	void SetFingerDriveMode(
 		const EAngularDriveMode::Type DriveMode,
@@ -0,0 +1,144 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enums/GraspType.h"
+#include "UObject/SoftObjectPath.h"
+
+#include "GraspScenario.generated.h"
+
+class UStaticMesh;
+
+/*
+ * An object to grasp and how the hand is driven to grasp it
+ */
+USTRUCT(BlueprintType)
+struct FGraspScenario
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Default constructor
+	FGraspScenario() :
+		ItemMesh(nullptr),
+		ItemTransform(FTransform::Identity),
+		GraspType(EGraspType::LargeDiameter),
+		bReplayLeftHand(false),
+		PoseIndex(INDEX_NONE)
+	{}
+
+	// Name of the scenario in the results
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+		FString Name;
+
+	// Mesh of the object to grasp
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+		UStaticMesh* ItemMesh;
+
+	// Mesh of the object to grasp, loaded when the scenario starts (if no ItemMesh is set)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+		FSoftObjectPath ItemMeshPath;
+
+	// World transform of the object at the start
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+		FTransform ItemTransform;
+
+	// Grasp type of the hand
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+		EGraspType GraspType;
+
+	// Input recording driving the hand, relative to the saved directory (scripted grasp if empty)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+		FString InputRecordingFile;
+
+	// Replay the left motion controller of the recording instead of the right one
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+		bool bReplayLeftHand;
+
+	// Index of the randomized spawn pose of a generated batch scenario (INDEX_NONE otherwise)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		int32 PoseIndex;
+};
+
+/*
+ * Outcome and timing of a grasp scenario
+ */
+USTRUCT(BlueprintType)
+struct FGraspScenarioResult
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Default constructor
+	FGraspScenarioResult() :
+		GraspType(EGraspType::LargeDiameter),
+		PoseIndex(INDEX_NONE),
+		bSuccess(false),
+		bReachedTarget(false),
+		HoldDuration(0.0f),
+		ItemLift(0.0f),
+		ItemDistanceToHand(0.0f),
+		NumSteps(0),
+		SimulatedTime(0.0f),
+		WallTime(0.0f),
+		MeanStepTime(0.0f),
+		MaxStepTime(0.0f)
+	{}
+
+	// Name of the scenario
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		FString Name;
+
+	// Name of the object mesh
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		FString ItemName;
+
+	// Grasp type of the hand
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		EGraspType GraspType;
+
+	// Index of the randomized spawn pose (INDEX_NONE if not generated)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		int32 PoseIndex;
+
+	// The object reached the target box, or has been held lifted long enough without a target box
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		bool bSuccess;
+
+	// The object overlapped the target box
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		bool bReachedTarget;
+
+	// Longest time the object has been held lifted (s)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		float HoldDuration;
+
+	// Height of the object at the end relative to the start (cm)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		float ItemLift;
+
+	// Distance of the object to the hand at the end (cm)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		float ItemDistanceToHand;
+
+	// Number of simulated steps
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		int32 NumSteps;
+
+	// Simulated time (s)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		float SimulatedTime;
+
+	// Real time it took to simulate (s)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		float WallTime;
+
+	// Mean real time of a step (ms)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		float MeanStepTime;
+
+	// Maximum real time of a step (ms)
+	UPROPERTY(BlueprintReadOnly, Category = "Scenario")
+		float MaxStepTime;
+};
@@ -0,0 +1,164 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Finger.h"
+
+#include "HandStateSnapshot.generated.h"
+
+/*
+ * Physics state of a finger joint (constraint and child bone)
+ */
+USTRUCT(BlueprintType)
+struct FJointState
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Default constructor
+	FJointState() :
+		bValid(false),
+		BodyTransform(FTransform::Identity),
+		LinearVelocity(FVector::ZeroVector),
+		AngularVelocity(FVector::ZeroVector),
+		LinearForce(FVector::ZeroVector),
+		AngularForce(FVector::ZeroVector),
+		Swing1(0.0f),
+		Swing2(0.0f),
+		Twist(0.0f)
+	{}
+
+	// The joint exists in the hand skeleton
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		bool bValid;
+
+	// World transform of the bone
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FTransform BodyTransform;
+
+	// World linear velocity of the bone (cm/s)
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FVector LinearVelocity;
+
+	// World angular velocity of the bone (rad/s)
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FVector AngularVelocity;
+
+	// Linear force applied by the constraint
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FVector LinearForce;
+
+	// Angular force applied by the constraint
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FVector AngularForce;
+
+	// Current swing1 angle of the constraint (rad)
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		float Swing1;
+
+	// Current swing2 angle of the constraint (rad)
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		float Swing2;
+
+	// Current twist angle of the constraint (rad)
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		float Twist;
+};
+
+/*
+ * Handle of a hand constraint, resolved once and used for constant time force queries
+ */
+USTRUCT(BlueprintType)
+struct FHandJointHandle
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Default constructor
+	FHandJointHandle() : ConstraintIndex(INDEX_NONE)
+	{}
+
+	// Constructor
+	explicit FHandJointHandle(const int32 InConstraintIndex) : ConstraintIndex(InConstraintIndex)
+	{}
+
+	// Index of the constraint in the skeletal mesh component
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		int32 ConstraintIndex;
+
+	FORCEINLINE bool IsValid() const { return ConstraintIndex != INDEX_NONE; }
+};
+
+/*
+ * Physics state of the whole hand, read once per tick and shared by all consumers
+ */
+USTRUCT(BlueprintType)
+struct FHandStateSnapshot
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Number of fingers of a hand
+	static const int32 NumFingers = 5;
+
+	// Number of parts of a finger
+	static const int32 NumFingerParts = 4;
+
+	// Default constructor
+	FHandStateSnapshot() :
+		TimeSeconds(0.0f),
+		RootTransform(FTransform::Identity),
+		RootLinearVelocity(FVector::ZeroVector),
+		RootAngularVelocity(FVector::ZeroVector),
+		MaxAngularForce(0.0f)
+	{
+		Joints.SetNum(NumFingers * NumFingerParts);
+	}
+
+	// World time of the snapshot
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		float TimeSeconds;
+
+	// World transform of the hand root body
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FTransform RootTransform;
+
+	// World linear velocity of the hand root body (cm/s)
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FVector RootLinearVelocity;
+
+	// World angular velocity of the hand root body (rad/s)
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		FVector RootAngularVelocity;
+
+	// Maximal angular force of all constraints of the hand
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		float MaxAngularForce;
+
+	// Angular force of every constraint of the hand, indexed with FHandJointHandle
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		TArray<float> AngularForces;
+
+	// State of the finger joints, indexed with GetJointIndex
+	UPROPERTY(BlueprintReadOnly, Category = "Hand State")
+		TArray<FJointState> Joints;
+
+	// Index of the finger part in the joints array
+	static FORCEINLINE int32 GetJointIndex(const EFingerType FingerType, const EFingerPart FingerPart)
+	{
+		return static_cast<int32>(FingerType) * NumFingerParts + static_cast<int32>(FingerPart);
+	}
+
+	// State of the given finger part
+	FORCEINLINE const FJointState& GetJoint(const EFingerType FingerType, const EFingerPart FingerPart) const
+	{
+		return Joints[GetJointIndex(FingerType, FingerPart)];
+	}
+
+	// State of the given finger part
+	FORCEINLINE FJointState& GetJoint(const EFingerType FingerType, const EFingerPart FingerPart)
+	{
+		return Joints[GetJointIndex(FingerType, FingerPart)];
+	}
+};
@@ -0,0 +1,46 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "PosePredictionStats.generated.h"
+
+/*
+ * Error of the pose predictions compared to the poses sampled later
+ */
+USTRUCT(BlueprintType)
+struct FPosePredictionStats
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Default constructor
+	FPosePredictionStats() :
+		NumPredictions(0),
+		MeanLocationError(0.0f),
+		MaxLocationError(0.0f),
+		MeanRotationError(0.0f),
+		MaxRotationError(0.0f)
+	{}
+
+	// Number of evaluated predictions
+	UPROPERTY(BlueprintReadOnly, Category = "Prediction")
+		int32 NumPredictions;
+
+	// Mean location error (cm)
+	UPROPERTY(BlueprintReadOnly, Category = "Prediction")
+		float MeanLocationError;
+
+	// Maximum location error (cm)
+	UPROPERTY(BlueprintReadOnly, Category = "Prediction")
+		float MaxLocationError;
+
+	// Mean rotation error (deg)
+	UPROPERTY(BlueprintReadOnly, Category = "Prediction")
+		float MeanRotationError;
+
+	// Maximum rotation error (deg)
+	UPROPERTY(BlueprintReadOnly, Category = "Prediction")
+		float MaxRotationError;
+};
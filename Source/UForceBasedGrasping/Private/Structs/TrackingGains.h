@@ -0,0 +1,51 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TrackingGains.generated.h"
+
+/*
+ * Gains of the hand tracking controller for a bucket of moved masses
+ */
+USTRUCT(BlueprintType)
+struct FTrackingGains
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	// Default constructor
+	FTrackingGains() :
+		MaxMass(0.0f),
+		PGain(0.0f),
+		IGain(0.0f),
+		DGain(0.0f),
+		MaxOutput(0.0f),
+		RotationBoost(0.0f)
+	{}
+
+	// Upper bound of the mass bucket (kg), the hand with the attached objects
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Gains", meta = (ClampMin = 0))
+		float MaxMass;
+
+	// Proportional gain
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Gains")
+		float PGain;
+
+	// Integral gain
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Gains")
+		float IGain;
+
+	// Derivative gain
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Gains")
+		float DGain;
+
+	// Maximum output (absolute value)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Gains")
+		float MaxOutput;
+
+	// Rotation boost
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Gains")
+		float RotationBoost;
+};
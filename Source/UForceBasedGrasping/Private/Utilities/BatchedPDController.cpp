@@ -0,0 +1,129 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "BatchedPDController.h"
+
+// Add a controller, returns its slot
+int32 BatchedPDController::AddController(const float PGain, const float DGain, const float MaxOutput)
+{
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(false);
+	}
+	else
+	{
+		Slot = PGains.Num();
+		ErrorX.Add(0.0f); ErrorY.Add(0.0f); ErrorZ.Add(0.0f);
+		PrevErrorX.Add(0.0f); PrevErrorY.Add(0.0f); PrevErrorZ.Add(0.0f);
+		RateX.Add(0.0f); RateY.Add(0.0f); RateZ.Add(0.0f); RateWeights.Add(0.0f);
+		OutputX.Add(0.0f); OutputY.Add(0.0f); OutputZ.Add(0.0f);
+		PGains.Add(0.0f); DGains.Add(0.0f); MaxOutputs.Add(0.0f);
+	}
+
+	// Start without history, as a new PIDController3D
+	ErrorX[Slot] = ErrorY[Slot] = ErrorZ[Slot] = 0.0f;
+	PrevErrorX[Slot] = PrevErrorY[Slot] = PrevErrorZ[Slot] = 0.0f;
+	RateX[Slot] = RateY[Slot] = RateZ[Slot] = RateWeights[Slot] = 0.0f;
+	OutputX[Slot] = OutputY[Slot] = OutputZ[Slot] = 0.0f;
+	BatchedPDController::SetGains(Slot, PGain, DGain, MaxOutput);
+	return Slot;
+}
+
+// Remove the controller of the slot
+void BatchedPDController::RemoveController(const int32 Slot)
+{
+	if (!PGains.IsValidIndex(Slot)) return;
+
+	// Zero gains keep the output of the slot at zero in the update
+	BatchedPDController::SetGains(Slot, 0.0f, 0.0f, 0.0f);
+	ErrorX[Slot] = ErrorY[Slot] = ErrorZ[Slot] = 0.0f;
+	FreeSlots.Add(Slot);
+}
+
+// Set the gains of the controller of the slot
+void BatchedPDController::SetGains(const int32 Slot, const float PGain, const float DGain, const float MaxOutput)
+{
+	PGains[Slot] = PGain;
+	DGains[Slot] = DGain;
+	MaxOutputs[Slot] = FMath::Abs(MaxOutput);
+}
+
+// Set the error of the controller of the slot for the next update
+void BatchedPDController::SetError(const int32 Slot, const FVector& Error)
+{
+	ErrorX[Slot] = Error.X;
+	ErrorY[Slot] = Error.Y;
+	ErrorZ[Slot] = Error.Z;
+	RateWeights[Slot] = 0.0f;
+}
+
+// Set the error and the measured error rate of the controller of the slot for the next update
+void BatchedPDController::SetError(const int32 Slot, const FVector& Error, const FVector& ErrorRate)
+{
+	ErrorX[Slot] = Error.X;
+	ErrorY[Slot] = Error.Y;
+	ErrorZ[Slot] = Error.Z;
+	RateX[Slot] = ErrorRate.X;
+	RateY[Slot] = ErrorRate.Y;
+	RateZ[Slot] = ErrorRate.Z;
+	RateWeights[Slot] = 1.0f;
+}
+
+namespace
+{
+	// PD update of one component of all controllers
+	FORCEINLINE void UpdateComponent(const int32 Num, const float InvDeltaTime,
+		const float* RESTRICT Error, float* RESTRICT PrevError, const float* RESTRICT Rate, const float* RESTRICT RateWeights,
+		float* RESTRICT Output, const float* RESTRICT PGains, const float* RESTRICT DGains, const float* RESTRICT MaxOutputs)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			// Measured rate or difference of the errors, blended to stay branch free
+			const float ErrorDiff = (Error[Index] - PrevError[Index]) * InvDeltaTime;
+			const float ErrorRate = ErrorDiff + RateWeights[Index] * (Rate[Index] - ErrorDiff);
+			const float Out = PGains[Index] * Error[Index] + DGains[Index] * ErrorRate;
+			Output[Index] = FMath::Min(FMath::Max(Out, -MaxOutputs[Index]), MaxOutputs[Index]);
+			PrevError[Index] = Error[Index];
+		}
+	}
+}
+
+// Update all controllers with their errors
+void BatchedPDController::Update(const float DeltaTime)
+{
+	if (DeltaTime <= 0.0f) return;
+
+	const int32 Num = PGains.Num();
+	const float InvDeltaTime = 1.0f / DeltaTime;
+	UpdateComponent(Num, InvDeltaTime, ErrorX.GetData(), PrevErrorX.GetData(), RateX.GetData(), RateWeights.GetData(),
+		OutputX.GetData(), PGains.GetData(), DGains.GetData(), MaxOutputs.GetData());
+	UpdateComponent(Num, InvDeltaTime, ErrorY.GetData(), PrevErrorY.GetData(), RateY.GetData(), RateWeights.GetData(),
+		OutputY.GetData(), PGains.GetData(), DGains.GetData(), MaxOutputs.GetData());
+	UpdateComponent(Num, InvDeltaTime, ErrorZ.GetData(), PrevErrorZ.GetData(), RateZ.GetData(), RateWeights.GetData(),
+		OutputZ.GetData(), PGains.GetData(), DGains.GetData(), MaxOutputs.GetData());
+}
+
+// Update only the controller of the slot with its error
+void BatchedPDController::UpdateSlot(const int32 Slot, const float DeltaTime)
+{
+	if (DeltaTime <= 0.0f || !PGains.IsValidIndex(Slot)) return;
+
+	// The same kernel over a range of one slot
+	const float InvDeltaTime = 1.0f / DeltaTime;
+	UpdateComponent(1, InvDeltaTime, &ErrorX[Slot], &PrevErrorX[Slot], &RateX[Slot], &RateWeights[Slot],
+		&OutputX[Slot], &PGains[Slot], &DGains[Slot], &MaxOutputs[Slot]);
+	UpdateComponent(1, InvDeltaTime, &ErrorY[Slot], &PrevErrorY[Slot], &RateY[Slot], &RateWeights[Slot],
+		&OutputY[Slot], &PGains[Slot], &DGains[Slot], &MaxOutputs[Slot]);
+	UpdateComponent(1, InvDeltaTime, &ErrorZ[Slot], &PrevErrorZ[Slot], &RateZ[Slot], &RateWeights[Slot],
+		&OutputZ[Slot], &PGains[Slot], &DGains[Slot], &MaxOutputs[Slot]);
+}
+
+// Clear the error history of the slot
+void BatchedPDController::ResetHistory(const int32 Slot)
+{
+	if (!PGains.IsValidIndex(Slot)) return;
+
+	ErrorX[Slot] = ErrorY[Slot] = ErrorZ[Slot] = 0.0f;
+	PrevErrorX[Slot] = PrevErrorY[Slot] = PrevErrorZ[Slot] = 0.0f;
+	OutputX[Slot] = OutputY[Slot] = OutputZ[Slot] = 0.0f;
+}
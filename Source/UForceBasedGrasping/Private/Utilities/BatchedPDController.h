@@ -0,0 +1,78 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * PD controllers of 3D errors for many hands, updated together in one pass.
+ * The state is kept in one array per component (structure of arrays), so the update loop
+ * runs over contiguous floats without branches and can be vectorized by the compiler.
+ * Same output as PIDController3D::UpdateAsPD: P * Error + D * dError/dt, clamped per component.
+ * With a measured error rate (e.g. the negated velocity) the D term uses it instead of the difference of the errors.
+ */
+class UFORCEBASEDGRASPING_API BatchedPDController
+{
+public:
+	// Add a controller, returns its slot (reuses the removed slots)
+	int32 AddController(const float PGain, const float DGain, const float MaxOutput);
+
+	// Remove the controller of the slot
+	void RemoveController(const int32 Slot);
+
+	// Set the gains of the controller of the slot
+	void SetGains(const int32 Slot, const float PGain, const float DGain, const float MaxOutput);
+
+	// Set the error of the controller of the slot for the next update
+	void SetError(const int32 Slot, const FVector& Error);
+
+	// Set the error and the measured error rate of the controller of the slot for the next update
+	void SetError(const int32 Slot, const FVector& Error, const FVector& ErrorRate);
+
+	// Update all controllers with their errors
+	void Update(const float DeltaTime);
+
+	// Update only the controller of the slot with its error
+	void UpdateSlot(const int32 Slot, const float DeltaTime);
+
+	// Clear the error history of the slot, the D term restarts without a kick
+	void ResetHistory(const int32 Slot);
+
+	// Output of the controller of the slot of the last update
+	FVector GetOutput(const int32 Slot) const { return FVector(OutputX[Slot], OutputY[Slot], OutputZ[Slot]); };
+
+	// Number of slots (including the removed ones)
+	int32 GetNumSlots() const { return PGains.Num(); };
+
+private:
+	// Current errors
+	TArray<float> ErrorX;
+	TArray<float> ErrorY;
+	TArray<float> ErrorZ;
+
+	// Errors of the previous update
+	TArray<float> PrevErrorX;
+	TArray<float> PrevErrorY;
+	TArray<float> PrevErrorZ;
+
+	// Measured error rates
+	TArray<float> RateX;
+	TArray<float> RateY;
+	TArray<float> RateZ;
+
+	// Weight of the measured error rate in the D term (1 = measured, 0 = difference of the errors)
+	TArray<float> RateWeights;
+
+	// Outputs of the last update
+	TArray<float> OutputX;
+	TArray<float> OutputY;
+	TArray<float> OutputZ;
+
+	// Gains, the removed slots have zero gains
+	TArray<float> PGains;
+	TArray<float> DGains;
+	TArray<float> MaxOutputs;
+
+	// Removed slots
+	TArray<int32> FreeSlots;
+};
@@ -1,192 +1,179 @@
-// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
-
-#include "GraspLogger.h"
-#include "TimerManager.h"
-#include "Paths.h"
-#include "Kismet/GameplayStatics.h"
-#include "Engine/World.h"
-
-// Sets default values
-AGraspLogger::AGraspLogger() :
-	Hand(nullptr),
-	LastGraspStatus(EGraspStatus::Stopped),
-	ForceTableFilename("Force.csv"),
-	LoggingCounter(1),
-	bLoggingEnabled(false),
-	bUpdateTimer(false)
-{
-	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
-	ForceFileWriterPtr = MakeShareable(new ForceFileWriter());
-}
-
-// Called when the game starts or when spawned
-void AGraspLogger::BeginPlay()
-{
-	Super::BeginPlay();
-
-	UE_LOG(LogTemp, Warning, TEXT("Try to Bind Logging Toggler"));
-
-	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-	if (PlayerController)
-	{
-		if (PlayerController->InputComponent)
-		{
-
-			UE_LOG(LogTemp, Warning, TEXT("Bind Logging Toggler"));
-			PlayerController->InputComponent->BindAction("ToggleHandLogging", IE_Pressed, this, &AGraspLogger::ToggleHandLogging);
-		}
-
-	}
-
-	if (ForceFileWriterPtr.IsValid())
-	{
-		ForceFileWriterPtr->CreateNewForceTableFileAndSaveOld(FPaths::ProjectSavedDir(), ForceTableFilename);
-	}
-}
-
-// Called every frame
-void AGraspLogger::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	if (!Hand || !bLoggingEnabled)
-		return;
-
-	if (LoggingCounter != 5) {
-		LoggingCounter++;
-		return;
-	}
-	else
-	{
-		LoggingCounter = 0;
-	}
-
-	if (LastGraspStatus != Hand->GraspPtr->GraspStatus)
-	{
-		if (Hand->GraspPtr->GraspStatus == EGraspStatus::Stopped) {
-			UE_LOG(LogTemp, Warning, TEXT("GraspStatus: Stopped"));
-		}
-		else if (Hand->GraspPtr->GraspStatus == EGraspStatus::Orientation) {
-			UE_LOG(LogTemp, Warning, TEXT("GraspStatus: Orientation"));
-		}
-
-
-		if (LastGraspStatus == EGraspStatus::Stopped && Hand->GraspPtr->GraspStatus == EGraspStatus::Orientation)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("StartLogging"));
-			ClearCurrentGraspInfo();
-
-			bUpdateTimer = true;
-		}
-		else if (LastGraspStatus == EGraspStatus::Orientation && Hand->GraspPtr->GraspStatus == EGraspStatus::Stopped)
-		{
-			bUpdateTimer = false;
-
-			if (ForceFileWriterPtr.IsValid())
-			{
-				if (ForceFileWriterPtr->WriteGraspInfoMapToFile(CurrentLogInfo, FPaths::ProjectSavedDir() + ForceTableFilename))
-				{
-					UE_LOG(LogTemp, Warning, TEXT("Logged to File"));
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("Logging to File Failed!"));
-				}
-			}
-			ClearCurrentGraspInfo();
-
-			UE_LOG(LogTemp, Warning, TEXT("StopLogging"));
-		}
-		else
-		{
-			bUpdateTimer = false;
-			UE_LOG(LogTemp, Warning, TEXT("AbortLogging"));
-		}
-
-		LastGraspStatus = Hand->GraspPtr->GraspStatus;
-	}
-
-	if (bUpdateTimer)
-	{
-		UpdateTimer();
-	}
-}
-
-void AGraspLogger::UpdateTimer()
-{
-	if (!Hand)
-		return;
-
-	FVector OutLinearForce;
-	FVector OutAngularForce;
-
-	CurrentLogInfo.GraspType = Hand->GraspPtr->CurrentGraspType;
-
-	if (Hand->GraspPtr->GraspStatus == EGraspStatus::Orientation)
-	{
-		Hand->Thumb.FingerPartToConstraint[EFingerPart::Distal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.ThumbDistal.Add(OutAngularForce.Size());
-
-		Hand->Thumb.FingerPartToConstraint[EFingerPart::Intermediate]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.ThumbIntermediate.Add(OutAngularForce.Size());
-
-		Hand->Thumb.FingerPartToConstraint[EFingerPart::Proximal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.ThumbProximal.Add(OutAngularForce.Size());
-
-		Hand->Index.FingerPartToConstraint[EFingerPart::Distal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.IndexDistal.Add(OutAngularForce.Size());
-
-		Hand->Index.FingerPartToConstraint[EFingerPart::Intermediate]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.IndexIntermediate.Add(OutAngularForce.Size());
-
-		Hand->Index.FingerPartToConstraint[EFingerPart::Proximal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.IndexProximal.Add(OutAngularForce.Size());
-
-		Hand->Middle.FingerPartToConstraint[EFingerPart::Distal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.MiddleDistal.Add(OutAngularForce.Size());
-
-		Hand->Middle.FingerPartToConstraint[EFingerPart::Intermediate]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.MiddleIntermediate.Add(OutAngularForce.Size());
-
-		Hand->Middle.FingerPartToConstraint[EFingerPart::Proximal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.MiddleProximal.Add(OutAngularForce.Size());
-
-		Hand->Ring.FingerPartToConstraint[EFingerPart::Distal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.RingDistal.Add(OutAngularForce.Size());
-
-		Hand->Ring.FingerPartToConstraint[EFingerPart::Intermediate]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.RingIntermediate.Add(OutAngularForce.Size());
-
-		Hand->Ring.FingerPartToConstraint[EFingerPart::Proximal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.RingProximal.Add(OutAngularForce.Size());
-
-		Hand->Pinky.FingerPartToConstraint[EFingerPart::Distal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.PinkyDistal.Add(OutAngularForce.Size());
-
-		Hand->Pinky.FingerPartToConstraint[EFingerPart::Intermediate]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.PinkyIntermediate.Add(OutAngularForce.Size());
-
-		Hand->Pinky.FingerPartToConstraint[EFingerPart::Proximal]->GetConstraintForce(OutLinearForce, OutAngularForce);
-		CurrentLogInfo.OrientationHandForces.PinkyProximal.Add(OutAngularForce.Size());
-
-	}
-}
-
-void AGraspLogger::ClearCurrentGraspInfo()
-{
-	CurrentLogInfo.Clear();
-}
-
-void AGraspLogger::ToggleHandLogging()
-{
-	if (bLoggingEnabled == true)
-	{
-		bLoggingEnabled = false;
-	}
-	else
-	{
-		bLoggingEnabled = true;
-	}
-	UE_LOG(LogTemp, Warning, TEXT("ToggleHandLogging: %s"), (bLoggingEnabled ? "true" : "false"));
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "GraspLogger.h"
+#include "TimerManager.h"
+#include "Paths.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "HandManager.h"
+
+// Sets default values
+AGraspLogger::AGraspLogger() :
+	Hand(nullptr),
+	LastGraspStatus(EGraspStatus::Stopped),
+	ForceTableFilename("Force.csv"),
+	LoggingCounter(1),
+	bLoggingEnabled(false),
+	bUpdateTimer(false)
+{
+	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	PrimaryActorTick.bCanEverTick = true;
+	ForceFileWriterPtr = MakeShareable(new ForceFileWriter());
+}
+
+// Called when the game starts or when spawned
+void AGraspLogger::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UE_LOG(LogTemp, Warning, TEXT("Try to Bind Logging Toggler"));
+
+	APlayerController* PlayerController = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+	if (PlayerController)
+	{
+		if (PlayerController->InputComponent)
+		{
+
+			UE_LOG(LogTemp, Warning, TEXT("Bind Logging Toggler"));
+			PlayerController->InputComponent->BindAction("ToggleHandLogging", IE_Pressed, this, &AGraspLogger::ToggleHandLogging);
+		}
+
+	}
+
+	// Read the hand state after the hand has updated it
+	if (Hand)
+	{
+		AddTickPrerequisiteActor(Hand);
+		AHandManager* const HandManager = AHandManager::Get(GetWorld());
+		if (HandManager)
+		{
+			AddTickPrerequisiteActor(HandManager);
+		}
+	}
+
+	if (ForceFileWriterPtr.IsValid())
+	{
+		ForceFileWriterPtr->CreateNewForceTableFileAndSaveOld(FPaths::ProjectSavedDir(), ForceTableFilename);
+	}
+}
+
+// Called every frame
+void AGraspLogger::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!Hand || !bLoggingEnabled)
+		return;
+
+	if (LoggingCounter != 5) {
+		LoggingCounter++;
+		return;
+	}
+	else
+	{
+		LoggingCounter = 0;
+	}
+
+	if (LastGraspStatus != Hand->GraspPtr->GraspStatus)
+	{
+		if (Hand->GraspPtr->GraspStatus == EGraspStatus::Stopped) {
+			UE_LOG(LogTemp, Warning, TEXT("GraspStatus: Stopped"));
+		}
+		else if (Hand->GraspPtr->GraspStatus == EGraspStatus::Orientation) {
+			UE_LOG(LogTemp, Warning, TEXT("GraspStatus: Orientation"));
+		}
+
+
+		if (LastGraspStatus == EGraspStatus::Stopped && Hand->GraspPtr->GraspStatus == EGraspStatus::Orientation)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("StartLogging"));
+			ClearCurrentGraspInfo();
+
+			bUpdateTimer = true;
+		}
+		else if (LastGraspStatus == EGraspStatus::Orientation && Hand->GraspPtr->GraspStatus == EGraspStatus::Stopped)
+		{
+			bUpdateTimer = false;
+
+			if (ForceFileWriterPtr.IsValid())
+			{
+				if (ForceFileWriterPtr->WriteGraspInfoMapToFile(CurrentLogInfo, FPaths::ProjectSavedDir() + ForceTableFilename))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Logged to File"));
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Logging to File Failed!"));
+				}
+			}
+			ClearCurrentGraspInfo();
+
+			UE_LOG(LogTemp, Warning, TEXT("StopLogging"));
+		}
+		else
+		{
+			bUpdateTimer = false;
+			UE_LOG(LogTemp, Warning, TEXT("AbortLogging"));
+		}
+
+		LastGraspStatus = Hand->GraspPtr->GraspStatus;
+	}
+
+	if (bUpdateTimer)
+	{
+		UpdateTimer();
+	}
+}
+
+void AGraspLogger::UpdateTimer()
+{
+	if (!Hand)
+		return;
+
+	CurrentLogInfo.GraspType = Hand->GraspPtr->CurrentGraspType;
+
+	if (Hand->GraspPtr->GraspStatus == EGraspStatus::Orientation)
+	{
+		// Forces are read once per tick by the hand
+		const FHandStateSnapshot& HandState = Hand->GetHandState();
+		FHandForces& Forces = CurrentLogInfo.OrientationHandForces;
+
+		Forces.ThumbDistal.Add(HandState.GetJoint(EFingerType::Thumb, EFingerPart::Distal).AngularForce.Size());
+		Forces.ThumbIntermediate.Add(HandState.GetJoint(EFingerType::Thumb, EFingerPart::Intermediate).AngularForce.Size());
+		Forces.ThumbProximal.Add(HandState.GetJoint(EFingerType::Thumb, EFingerPart::Proximal).AngularForce.Size());
+
+		Forces.IndexDistal.Add(HandState.GetJoint(EFingerType::Index, EFingerPart::Distal).AngularForce.Size());
+		Forces.IndexIntermediate.Add(HandState.GetJoint(EFingerType::Index, EFingerPart::Intermediate).AngularForce.Size());
+		Forces.IndexProximal.Add(HandState.GetJoint(EFingerType::Index, EFingerPart::Proximal).AngularForce.Size());
+
+		Forces.MiddleDistal.Add(HandState.GetJoint(EFingerType::Middle, EFingerPart::Distal).AngularForce.Size());
+		Forces.MiddleIntermediate.Add(HandState.GetJoint(EFingerType::Middle, EFingerPart::Intermediate).AngularForce.Size());
+		Forces.MiddleProximal.Add(HandState.GetJoint(EFingerType::Middle, EFingerPart::Proximal).AngularForce.Size());
+
+		Forces.RingDistal.Add(HandState.GetJoint(EFingerType::Ring, EFingerPart::Distal).AngularForce.Size());
+		Forces.RingIntermediate.Add(HandState.GetJoint(EFingerType::Ring, EFingerPart::Intermediate).AngularForce.Size());
+		Forces.RingProximal.Add(HandState.GetJoint(EFingerType::Ring, EFingerPart::Proximal).AngularForce.Size());
+
+		Forces.PinkyDistal.Add(HandState.GetJoint(EFingerType::Pinky, EFingerPart::Distal).AngularForce.Size());
+		Forces.PinkyIntermediate.Add(HandState.GetJoint(EFingerType::Pinky, EFingerPart::Intermediate).AngularForce.Size());
+		Forces.PinkyProximal.Add(HandState.GetJoint(EFingerType::Pinky, EFingerPart::Proximal).AngularForce.Size());
+	}
+}
+
+void AGraspLogger::ClearCurrentGraspInfo()
+{
+	CurrentLogInfo.Clear();
+}
+
+void AGraspLogger::ToggleHandLogging()
+{
+	if (bLoggingEnabled == true)
+	{
+		bLoggingEnabled = false;
+	}
+	else
+	{
+		bLoggingEnabled = true;
+	}
+	UE_LOG(LogTemp, Warning, TEXT("ToggleHandLogging: %s"), (bLoggingEnabled ? "true" : "false"));
 }
\ No newline at end of file
@@ -0,0 +1,526 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "GraspScenarioRunner.h"
+#include "Hand.h"
+#include "HandManager.h"
+#include "GraspableItemIndex.h"
+#include "Engine/TriggerBox.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "FileHelper.h"
+#include "Paths.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "HAL/PlatformTime.h"
+
+// Sets default values
+AGraspScenarioRunner::AGraspScenarioRunner()
+{
+	// Set the hand targets before the hands are updated
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickGroup = TG_PrePhysics;
+
+	bRunOnBeginPlay = false;
+	bQuitWhenDone = false;
+	Timestep = 1.0f / 120.0f;
+	ResultsFile = TEXT("GraspScenarioResults.csv");
+	SuccessMinLift = 10.0f;
+	SuccessMinHoldTime = 0.5f;
+	TargetBox = nullptr;
+
+	// Batch default values
+	bGenerateBatch = false;
+	NumSpawnPoses = 3;
+	SpawnTransform = FTransform(FVector(0.0f, 0.0f, 100.0f));
+	SpawnLocationJitter = FVector(10.0f, 10.0f, 0.0f);
+	SpawnYawJitter = 180.0f;
+	RandomSeed = 0;
+
+	// Scripted grasp default values
+	HandGraspTransform = FTransform(FVector(0.0f, 0.0f, 10.0f));
+	ApproachOffset = FVector(0.0f, 0.0f, 20.0f);
+	ApproachTime = 0.5f;
+	SettleTime = 0.5f;
+	CloseTime = 1.0f;
+	LiftTime = 1.0f;
+	HoldTime = 1.0f;
+	LiftHeight = 20.0f;
+	CarryTime = 1.0f;
+
+	// Same gains as the motion controller character
+	PGain = 700.0f;
+	IGain = 0.0f;
+	DGain = 50.0f;
+	MaxOutput = 350000.0f;
+	RotationBoost = 12000.f;
+
+	bRunning = false;
+	ScenarioIndex = INDEX_NONE;
+	Hand = nullptr;
+	Item = nullptr;
+	bReplaying = false;
+	ScenarioTime = 0.0f;
+	LiftedTime = 0.0f;
+	ScenarioStartSeconds = 0.0;
+	LastStepSeconds = 0.0;
+	bPrevUseFixedTimeStep = false;
+	PrevFixedDeltaTime = 0.0;
+}
+
+// Called when the game starts or when spawned
+void AGraspScenarioRunner::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Update the hands after the targets are set
+	AHandManager* const HandManager = AHandManager::Get(GetWorld());
+	if (HandManager)
+	{
+		HandManager->AddTickPrerequisiteActor(this);
+	}
+
+	// Started from the command line, quit when done
+	if (FParse::Param(FCommandLine::Get(), TEXT("RunGraspScenarios")))
+	{
+		bRunOnBeginPlay = true;
+		bQuitWhenDone = true;
+	}
+	if (FParse::Param(FCommandLine::Get(), TEXT("GraspBatch")))
+	{
+		bGenerateBatch = true;
+	}
+	FParse::Value(FCommandLine::Get(), TEXT("GraspBatchPoses="), NumSpawnPoses);
+	FParse::Value(FCommandLine::Get(), TEXT("GraspBatchSeed="), RandomSeed);
+
+	if (bRunOnBeginPlay)
+	{
+		AGraspScenarioRunner::RunScenarios();
+	}
+}
+
+// Called when the actor is removed from the world
+void AGraspScenarioRunner::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRunning)
+	{
+		FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+		bRunning = false;
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+// Start running the scenarios
+void AGraspScenarioRunner::RunScenarios()
+{
+	if (bRunning) return;
+
+	if (!HandClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Grasp scenario runner has no hand class"));
+		return;
+	}
+
+	// Step the world with the fixed timestep as fast as possible
+	bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(Timestep);
+
+	// The batch is rebuilt for every run, the configured scenarios are kept as they are
+	RunScenarioList = Scenarios;
+	if (bGenerateBatch)
+	{
+		AGraspScenarioRunner::GenerateBatchScenarios();
+	}
+
+	bRunning = true;
+	Results.Empty();
+	ScenarioIndex = INDEX_NONE;
+
+	// Skip the scenarios that can not be started
+	int32 NextIndex = 0;
+	while (NextIndex < RunScenarioList.Num() && !AGraspScenarioRunner::StartScenario(NextIndex))
+	{
+		++NextIndex;
+	}
+	if (ScenarioIndex == INDEX_NONE)
+	{
+		AGraspScenarioRunner::FinishRun();
+	}
+}
+
+// Called every frame
+void AGraspScenarioRunner::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bRunning || ScenarioIndex == INDEX_NONE) return;
+
+	// Real time of the previous step, the physics of a step runs after this tick
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (CurrentResult.NumSteps > 0)
+	{
+		const float StepTime = static_cast<float>(NowSeconds - LastStepSeconds) * 1000.0f;
+		CurrentResult.MeanStepTime += StepTime;
+		CurrentResult.MaxStepTime = FMath::Max(CurrentResult.MaxStepTime, StepTime);
+	}
+	LastStepSeconds = NowSeconds;
+
+	const bool bScenarioRunning = bReplaying ?
+		AGraspScenarioRunner::UpdateReplayedGrasp() : AGraspScenarioRunner::UpdateScriptedGrasp();
+	ScenarioTime += Timestep;
+	++CurrentResult.NumSteps;
+	AGraspScenarioRunner::UpdateSuccessTests();
+
+	if (!bScenarioRunning)
+	{
+		AGraspScenarioRunner::FinishScenario();
+
+		int32 NextIndex = ScenarioIndex + 1;
+		ScenarioIndex = INDEX_NONE;
+		while (NextIndex < RunScenarioList.Num() && !AGraspScenarioRunner::StartScenario(NextIndex))
+		{
+			++NextIndex;
+		}
+		if (ScenarioIndex == INDEX_NONE)
+		{
+			AGraspScenarioRunner::FinishRun();
+		}
+	}
+}
+
+// Add the scenarios of the batch items x grasp types x spawn poses to the scenarios of the run
+void AGraspScenarioRunner::GenerateBatchScenarios()
+{
+	// Items out of the content folders (not loaded yet) and the meshes set
+	TArray<FGraspScenario> Items;
+	for (const FString& Path : BatchItemPaths)
+	{
+		for (const int32 ItemIndex : GraspableItemIndex::GetItemsInPath(TEXT("/Game/") + Path))
+		{
+			FGraspScenario Item;
+			Item.Name = GraspableItemIndex::GetItem(ItemIndex).Name.ToString();
+			Item.ItemMeshPath = GraspableItemIndex::GetItem(ItemIndex).MeshPath;
+			Items.Add(Item);
+		}
+	}
+	for (UStaticMesh* const Mesh : BatchItemMeshes)
+	{
+		if (Mesh)
+		{
+			FGraspScenario Item;
+			Item.Name = Mesh->GetName();
+			Item.ItemMesh = Mesh;
+			Items.Add(Item);
+		}
+	}
+
+	TArray<EGraspType> GraspTypes = BatchGraspTypes;
+	if (GraspTypes.Num() == 0)
+	{
+		const UEnum* EnumPtr = FindObject<UEnum>(ANY_PACKAGE, TEXT("EGraspType"), true);
+		for (int32 Counter = 0; EnumPtr && Counter < EnumPtr->GetMaxEnumValue(); Counter++)
+		{
+			GraspTypes.Add(EGraspType(Counter));
+		}
+	}
+
+	// The same poses for all items and grasp types, the trials differ only in item and grasp type
+	FRandomStream RandomStream(RandomSeed);
+	TArray<FTransform> SpawnPoses;
+	for (int32 PoseIndex = 0; PoseIndex < NumSpawnPoses; ++PoseIndex)
+	{
+		FTransform Pose = SpawnTransform;
+		Pose.AddToTranslation(FVector(
+			RandomStream.FRandRange(-SpawnLocationJitter.X, SpawnLocationJitter.X),
+			RandomStream.FRandRange(-SpawnLocationJitter.Y, SpawnLocationJitter.Y),
+			RandomStream.FRandRange(-SpawnLocationJitter.Z, SpawnLocationJitter.Z)));
+		Pose.SetRotation(FQuat(FVector::UpVector, FMath::DegreesToRadians(RandomStream.FRandRange(-SpawnYawJitter, SpawnYawJitter))) * Pose.GetRotation());
+		SpawnPoses.Add(Pose);
+	}
+
+	const UEnum* EnumPtr = FindObject<UEnum>(ANY_PACKAGE, TEXT("EGraspType"), true);
+	RunScenarioList.Reserve(RunScenarioList.Num() + Items.Num() * GraspTypes.Num() * SpawnPoses.Num());
+	for (const FGraspScenario& Item : Items)
+	{
+		for (const EGraspType GraspType : GraspTypes)
+		{
+			const FString GraspTypeString = EnumPtr ? EnumPtr->GetDisplayNameTextByIndex(static_cast<int64>(GraspType)).ToString() : FString();
+			for (int32 PoseIndex = 0; PoseIndex < SpawnPoses.Num(); ++PoseIndex)
+			{
+				FGraspScenario Scenario = Item;
+				Scenario.Name = FString::Printf(TEXT("%s_%s_%d"), *Item.Name, *GraspTypeString, PoseIndex);
+				Scenario.ItemTransform = SpawnPoses[PoseIndex];
+				Scenario.GraspType = GraspType;
+				Scenario.PoseIndex = PoseIndex;
+				RunScenarioList.Add(Scenario);
+			}
+		}
+	}
+	UE_LOG(LogTemp, Log, TEXT("Grasp scenario batch: %d items x %d grasp types x %d poses"), Items.Num(), GraspTypes.Num(), SpawnPoses.Num());
+}
+
+// Spawn the hand and the object of the scenario at the index
+bool AGraspScenarioRunner::StartScenario(const int32 Index)
+{
+	const FGraspScenario& Scenario = RunScenarioList[Index];
+	UStaticMesh* const ItemMesh = Scenario.ItemMesh ? Scenario.ItemMesh : Cast<UStaticMesh>(Scenario.ItemMeshPath.TryLoad());
+	if (!ItemMesh)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Grasp scenario %d (%s) has no item mesh, skipped"), Index, *Scenario.Name);
+		return false;
+	}
+
+	bReplaying = !Scenario.InputRecordingFile.IsEmpty();
+	if (bReplaying && !InputRecording.LoadFromFile(FPaths::ProjectSavedDir() + Scenario.InputRecordingFile))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Grasp scenario %d (%s) has no valid input recording, skipped"), Index, *Scenario.Name);
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	Item = GetWorld()->SpawnActor<AStaticMeshActor>(Scenario.ItemTransform.GetLocation(), Scenario.ItemTransform.Rotator(), SpawnParams);
+	if (!Item)
+	{
+		return false;
+	}
+	Item->SetActorScale3D(Scenario.ItemTransform.GetScale3D());
+	Item->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+	Item->GetStaticMeshComponent()->SetStaticMesh(ItemMesh);
+	Item->GetStaticMeshComponent()->SetSimulatePhysics(true);
+	Item->GetStaticMeshComponent()->bGenerateOverlapEvents = true;
+
+	// The hand starts at its first target
+	const FTransform HandStart = bReplaying ? (Scenario.bReplayLeftHand ?
+		FTransform(InputRecording.GetFrame(0).LeftRotation, InputRecording.GetFrame(0).LeftLocation) :
+		FTransform(InputRecording.GetFrame(0).RightRotation, InputRecording.GetFrame(0).RightLocation)) :
+		HandGraspTransform * Scenario.ItemTransform * FTransform(ApproachOffset);
+	Hand = GetWorld()->SpawnActor<AHand>(HandClass, HandStart.GetLocation(), HandStart.Rotator(), SpawnParams);
+	if (!Hand)
+	{
+		Item->Destroy();
+		Item = nullptr;
+		return false;
+	}
+	Hand->SetTrackingController(PGain, IGain, DGain, MaxOutput, RotationBoost);
+	Hand->SwitchGraspType(Scenario.GraspType);
+
+	ScenarioIndex = Index;
+	ScenarioTime = 0.0f;
+	LiftedTime = 0.0f;
+	CurrentResult = FGraspScenarioResult();
+	CurrentResult.Name = Scenario.Name.IsEmpty() ? ItemMesh->GetName() : Scenario.Name;
+	CurrentResult.ItemName = ItemMesh->GetName();
+	CurrentResult.GraspType = Scenario.GraspType;
+	CurrentResult.PoseIndex = Scenario.PoseIndex;
+	ScenarioStartSeconds = FPlatformTime::Seconds();
+	LastStepSeconds = ScenarioStartSeconds;
+	return true;
+}
+
+// Drive the hand with the scripted grasp: approach, settle, close, lift, carry to the target box and hold
+bool AGraspScenarioRunner::UpdateScriptedGrasp()
+{
+	const FGraspScenario& Scenario = RunScenarioList[ScenarioIndex];
+
+	// Progress of a phase starting at the time
+	auto PhaseAlpha = [this](const float StartTime, const float Duration)
+	{
+		return Duration > 0.0f ? FMath::Clamp((ScenarioTime - StartTime) / Duration, 0.0f, 1.0f) : 1.0f;
+	};
+	const float CarryDuration = TargetBox ? CarryTime : 0.0f;
+	const float ApproachAlpha = PhaseAlpha(0.0f, ApproachTime);
+	const float CloseAlpha = PhaseAlpha(ApproachTime + SettleTime, CloseTime);
+	const float LiftAlpha = PhaseAlpha(ApproachTime + SettleTime + CloseTime, LiftTime);
+	const float CarryAlpha = PhaseAlpha(ApproachTime + SettleTime + CloseTime + LiftTime, CarryDuration);
+
+	FTransform Target = HandGraspTransform * Scenario.ItemTransform;
+	Target.AddToTranslation(ApproachOffset * (1.0f - ApproachAlpha) + FVector(0.0f, 0.0f, LiftHeight * LiftAlpha));
+	if (TargetBox)
+	{
+		// Carry the object over the target box at the lift height
+		const FVector GraspToTarget = TargetBox->GetActorLocation() - Scenario.ItemTransform.GetLocation();
+		Target.AddToTranslation(FVector(GraspToTarget.X, GraspToTarget.Y, 0.0f) * CarryAlpha);
+	}
+	Hand->SetTrackingTarget(Target);
+	Hand->UpdateGrasp2(CloseAlpha);
+
+	return ScenarioTime < ApproachTime + SettleTime + CloseTime + LiftTime + CarryDuration + HoldTime;
+}
+
+// Update the lift and target tests of the current scenario
+void AGraspScenarioRunner::UpdateSuccessTests()
+{
+	const FGraspScenario& Scenario = RunScenarioList[ScenarioIndex];
+
+	// Longest time the object has been held lifted without interruption
+	const float Lift = Item->GetActorLocation().Z - Scenario.ItemTransform.GetLocation().Z;
+	LiftedTime = Lift >= SuccessMinLift ? LiftedTime + Timestep : 0.0f;
+	CurrentResult.HoldDuration = FMath::Max(CurrentResult.HoldDuration, LiftedTime);
+
+	if (TargetBox && !CurrentResult.bReachedTarget && TargetBox->IsOverlappingActor(Item))
+	{
+		CurrentResult.bReachedTarget = true;
+	}
+}
+
+// Drive the hand with the input recording
+bool AGraspScenarioRunner::UpdateReplayedGrasp()
+{
+	const FGraspScenario& Scenario = RunScenarioList[ScenarioIndex];
+
+	FMCInputFrame Frame;
+	if (!InputRecording.Replay(Timestep, Frame))
+	{
+		return false;
+	}
+
+	if (Scenario.bReplayLeftHand)
+	{
+		Hand->SetTrackingTarget(FTransform(Frame.LeftRotation, Frame.LeftLocation));
+		Hand->UpdateGrasp2(Frame.LeftGraspAxis);
+	}
+	else
+	{
+		Hand->SetTrackingTarget(FTransform(Frame.RightRotation, Frame.RightLocation));
+		Hand->UpdateGrasp2(Frame.RightGraspAxis);
+	}
+
+	// Actions of the replayed hand, the grasp type is set by the scenario
+	const EMCInputAction AttachAction = Scenario.bReplayLeftHand ? EMCInputAction::LeftFixationGrasp : EMCInputAction::RightFixationGrasp;
+	const EMCInputAction DetachAction = Scenario.bReplayLeftHand ? EMCInputAction::LeftGraspDetach : EMCInputAction::RightGraspDetach;
+	for (const FMCInputActionEvent& Event : Frame.Actions)
+	{
+		if (Event.Action == AttachAction)
+		{
+			Hand->TryOneHandFixationGrasp();
+		}
+		else if (Event.Action == DetachAction)
+		{
+			Hand->DetachFixationGrasp();
+		}
+		else if (Event.Action == EMCInputAction::SwitchGraspProcess)
+		{
+			Hand->SwitchGraspProcess();
+		}
+	}
+	return true;
+}
+
+// Evaluate the current scenario and remove its actors
+void AGraspScenarioRunner::FinishScenario()
+{
+	const FGraspScenario& Scenario = RunScenarioList[ScenarioIndex];
+
+	CurrentResult.ItemLift = Item->GetActorLocation().Z - Scenario.ItemTransform.GetLocation().Z;
+	CurrentResult.ItemDistanceToHand = FVector::Dist(Item->GetActorLocation(), Hand->GetActorLocation());
+	CurrentResult.bSuccess = TargetBox ? CurrentResult.bReachedTarget : CurrentResult.HoldDuration >= SuccessMinHoldTime;
+	CurrentResult.SimulatedTime = ScenarioTime;
+	CurrentResult.WallTime = static_cast<float>(FPlatformTime::Seconds() - ScenarioStartSeconds);
+	if (CurrentResult.NumSteps > 1)
+	{
+		CurrentResult.MeanStepTime /= CurrentResult.NumSteps - 1;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Grasp scenario %s: %s, lift %.1f cm, %d steps, %.2f s simulated in %.2f s (mean step %.2f ms, max %.2f ms)"),
+		*CurrentResult.Name, CurrentResult.bSuccess ? TEXT("success") : TEXT("failure"), CurrentResult.ItemLift,
+		CurrentResult.NumSteps, CurrentResult.SimulatedTime, CurrentResult.WallTime, CurrentResult.MeanStepTime, CurrentResult.MaxStepTime);
+	Results.Add(CurrentResult);
+
+	Hand->Destroy();
+	Hand = nullptr;
+	Item->Destroy();
+	Item = nullptr;
+}
+
+// Write the results, restore the timestep and quit if requested
+void AGraspScenarioRunner::FinishRun()
+{
+	bRunning = false;
+	FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+
+	int32 NumSuccess = 0;
+	for (const FGraspScenarioResult& Result : Results)
+	{
+		NumSuccess += Result.bSuccess ? 1 : 0;
+	}
+	UE_LOG(LogTemp, Log, TEXT("Grasp scenarios finished: %d of %d successful"), NumSuccess, Results.Num());
+	AGraspScenarioRunner::WriteResults();
+
+	if (bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+// Write the results to the results file
+void AGraspScenarioRunner::WriteResults() const
+{
+	const UEnum* EnumPtr = FindObject<UEnum>(ANY_PACKAGE, TEXT("EGraspType"), true);
+	auto GraspTypeName = [EnumPtr](const EGraspType GraspType)
+	{
+		return EnumPtr ? EnumPtr->GetDisplayNameTextByIndex(static_cast<int64>(GraspType)).ToString() : FString();
+	};
+
+	FString Csv = TEXT("Name;Item;GraspType;Pose;Success;ReachedTarget;HoldDuration;ItemLift;ItemDistanceToHand;NumSteps;SimulatedTime;WallTime;MeanStepTime;MaxStepTime\n");
+	for (const FGraspScenarioResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s;%s;%s;%d;%d;%d;%f;%f;%f;%d;%f;%f;%f;%f\n"),
+			*Result.Name, *Result.ItemName, *GraspTypeName(Result.GraspType), Result.PoseIndex,
+			Result.bSuccess ? 1 : 0, Result.bReachedTarget ? 1 : 0, Result.HoldDuration, Result.ItemLift, Result.ItemDistanceToHand,
+			Result.NumSteps, Result.SimulatedTime, Result.WallTime, Result.MeanStepTime, Result.MaxStepTime);
+	}
+
+	const FString Filename = FPaths::ProjectSavedDir() + ResultsFile;
+	if (!FFileHelper::SaveStringToFile(Csv, *Filename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Grasp scenario results could not be written to %s"), *Filename);
+	}
+
+	// Success rate table, one row per item and one column per grasp type (successful / trials)
+	TArray<FString> ItemNames;
+	TArray<EGraspType> GraspTypes;
+	TMap<FString, FIntPoint> Counts;
+	for (const FGraspScenarioResult& Result : Results)
+	{
+		ItemNames.AddUnique(Result.ItemName);
+		GraspTypes.AddUnique(Result.GraspType);
+		const FString Key = Result.ItemName + TEXT(";") + GraspTypeName(Result.GraspType);
+		FIntPoint* Count = Counts.Find(Key);
+		if (!Count)
+		{
+			Count = &Counts.Add(Key, FIntPoint::ZeroValue);
+		}
+		Count->X += Result.bSuccess ? 1 : 0;
+		++Count->Y;
+	}
+
+	FString Summary = TEXT("Item");
+	for (const EGraspType GraspType : GraspTypes)
+	{
+		Summary += TEXT(";") + GraspTypeName(GraspType);
+	}
+	Summary += TEXT("\n");
+	for (const FString& ItemName : ItemNames)
+	{
+		Summary += ItemName;
+		for (const EGraspType GraspType : GraspTypes)
+		{
+			const FIntPoint* Count = Counts.Find(ItemName + TEXT(";") + GraspTypeName(GraspType));
+			Summary += Count ? FString::Printf(TEXT(";%d/%d"), Count->X, Count->Y) : FString(TEXT(";"));
+		}
+		Summary += TEXT("\n");
+	}
+
+	const FString SummaryFilename = FPaths::GetBaseFilename(Filename, false) + TEXT("_Summary.csv");
+	if (!FFileHelper::SaveStringToFile(Summary, *SummaryFilename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Grasp scenario summary could not be written to %s"), *SummaryFilename);
+	}
+}
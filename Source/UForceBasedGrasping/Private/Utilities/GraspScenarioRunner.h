@@ -0,0 +1,244 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Structs/GraspScenario.h"
+#include "Utilities/MCInputRecording.h"
+
+#include "GraspScenarioRunner.generated.h"
+
+class AHand;
+class AStaticMeshActor;
+class ATriggerBox;
+
+/**
+ * Runs grasp scenarios back to back with a fixed timestep and no frame pacing, without VR hardware.
+ * Every scenario spawns a hand and an object, drives the hand with a scripted grasp and lift or with an input recording,
+ * and measures if the object has been lifted and how long the simulation took. The results are written to a csv file.
+ * A batch of scenarios can be generated for items x grasp types x randomized spawn poses, with a success rate table.
+ * Headless run: <Project> <Map with the runner> -game -nullrhi -nosound -unattended -RunGraspScenarios
+ * Batch run: ... -RunGraspScenarios -GraspBatch [-GraspBatchPoses=<N>] [-GraspBatchSeed=<N>]
+ */
+UCLASS()
+class UFORCEBASEDGRASPING_API AGraspScenarioRunner : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	AGraspScenarioRunner();
+
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+	// Called when the actor is removed from the world
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Called every frame
+	virtual void Tick(float DeltaTime) override;
+
+	// Start running the scenarios
+	UFUNCTION(BlueprintCallable, Category = "Scenario Runner")
+		void RunScenarios();
+
+	// Results of the finished scenarios
+	UFUNCTION(BlueprintPure, Category = "Scenario Runner")
+		TArray<FGraspScenarioResult> GetResults() const { return Results; };
+
+protected:
+	// Scenarios to run
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner")
+		TArray<FGraspScenario> Scenarios;
+
+	// Hand spawned for every scenario
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner")
+		TSubclassOf<AHand> HandClass;
+
+	// Run the scenarios at begin play (always the case with -RunGraspScenarios)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner")
+		bool bRunOnBeginPlay;
+
+	// Quit the game after the last scenario (always the case with -RunGraspScenarios)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner")
+		bool bQuitWhenDone;
+
+	// Fixed timestep of the simulation (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner", meta = (ClampMin = 0.001))
+		float Timestep;
+
+	// Results file, relative to the saved directory of the project
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner")
+		FString ResultsFile;
+
+	// Minimum lift of the object for a successful grasp (cm)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner", meta = (ClampMin = 0))
+		float SuccessMinLift;
+
+	// Minimum time the object has to be held lifted for a successful grasp (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner", meta = (ClampMin = 0))
+		float SuccessMinHoldTime;
+
+	// The object has to be carried into this box for a successful grasp, instead of the hold test (optional)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner")
+		ATriggerBox* TargetBox;
+
+	// Generate scenarios for the batch items x grasp types x spawn poses (always the case with -GraspBatch)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch")
+		bool bGenerateBatch;
+
+	// Content folders of the batch items (relative to /Game)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch")
+		TArray<FString> BatchItemPaths;
+
+	// Additional batch items
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch")
+		TArray<UStaticMesh*> BatchItemMeshes;
+
+	// Grasp types of the batch (all if empty)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch")
+		TArray<EGraspType> BatchGraspTypes;
+
+	// Number of randomized spawn poses per item and grasp type
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch", meta = (ClampMin = 1))
+		int32 NumSpawnPoses;
+
+	// Base spawn pose of the batch items
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch")
+		FTransform SpawnTransform;
+
+	// Maximum random offset of the spawn location (cm)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch")
+		FVector SpawnLocationJitter;
+
+	// Maximum random yaw of the spawn rotation (deg)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch", meta = (ClampMin = 0, ClampMax = 180))
+		float SpawnYawJitter;
+
+	// Seed of the spawn poses, the same poses are used for every item and grasp type
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Batch")
+		int32 RandomSeed;
+
+	// Start of the hand approach relative to the grasp pose (cm, world)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp")
+		FVector ApproachOffset;
+
+	// Time to move the hand from the approach start to the grasp pose (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp", meta = (ClampMin = 0))
+		float ApproachTime;
+
+	// Pose of the hand relative to the object in the scripted grasp
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp")
+		FTransform HandGraspTransform;
+
+	// Time for the object and the hand to settle before closing (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp", meta = (ClampMin = 0))
+		float SettleTime;
+
+	// Time to close the hand (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp", meta = (ClampMin = 0))
+		float CloseTime;
+
+	// Time to lift the hand (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp", meta = (ClampMin = 0))
+		float LiftTime;
+
+	// Time to hold the object after lifting (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp", meta = (ClampMin = 0))
+		float HoldTime;
+
+	// Height to lift the hand (cm)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp")
+		float LiftHeight;
+
+	// Time to carry the object from the lift pose to the target box, if any (s)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Scripted Grasp", meta = (ClampMin = 0))
+		float CarryTime;
+
+	// Hand tracking controller proportional argument
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Control")
+		float PGain;
+
+	// Hand tracking controller integral argument
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Control")
+		float IGain;
+
+	// Hand tracking controller derivative argument
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Control")
+		float DGain;
+
+	// Hand tracking controller maximum output (absolute value)
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Control")
+		float MaxOutput;
+
+	// Hand rotation tracking boost
+	UPROPERTY(EditAnywhere, Category = "Scenario Runner|Control")
+		float RotationBoost;
+
+private:
+	// The scenarios are running
+	bool bRunning;
+
+	// Index of the current scenario
+	int32 ScenarioIndex;
+
+	// Hand of the current scenario
+	AHand* Hand;
+
+	// Object of the current scenario
+	AStaticMeshActor* Item;
+
+	// Input of the current scenario, if replayed
+	MCInputRecording InputRecording;
+
+	// The current scenario replays an input recording
+	bool bReplaying;
+
+	// Simulated time of the current scenario
+	float ScenarioTime;
+
+	// Result of the current scenario
+	FGraspScenarioResult CurrentResult;
+
+	// Time the object of the current scenario has been lifted without interruption (s)
+	float LiftedTime;
+
+	// Real time of the start of the current scenario and of the last step
+	double ScenarioStartSeconds;
+	double LastStepSeconds;
+
+	// Results of the finished scenarios
+	TArray<FGraspScenarioResult> Results;
+
+	// Fixed timestep settings of the engine before the run
+	bool bPrevUseFixedTimeStep;
+	double PrevFixedDeltaTime;
+
+	// Configured scenarios followed by the generated batch, rebuilt for every run
+	TArray<FGraspScenario> RunScenarioList;
+
+	// Add the scenarios of the batch items x grasp types x spawn poses to the scenarios of the run
+	void GenerateBatchScenarios();
+
+	// Spawn the hand and the object of the scenario at the index
+	bool StartScenario(const int32 Index);
+
+	// Update the lift and target tests of the current scenario
+	void UpdateSuccessTests();
+
+	// Evaluate the current scenario and remove its actors
+	void FinishScenario();
+
+	// Write the results, restore the timestep and quit if requested
+	void FinishRun();
+
+	// Drive the hand with the scripted grasp, returns false when it is finished
+	bool UpdateScriptedGrasp();
+
+	// Drive the hand with the input recording, returns false when it is finished
+	bool UpdateReplayedGrasp();
+
+	// Write the results to the results file, and the success rates by item and grasp type to the summary file
+	void WriteResults() const;
+};
@@ -0,0 +1,90 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "GraspableItemIndex.h"
+#include "AssetRegistryModule.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+
+TArray<FGraspableItemInfo> GraspableItemIndex::Items;
+TMap<FString, TArray<int32>> GraspableItemIndex::PathItems;
+
+// Get the indices of the items of the package path, indexes the path on first use
+const TArray<int32>& GraspableItemIndex::GetItemsInPath(const FString& PackagePath)
+{
+	check(IsInGameThread());
+
+	if (const TArray<int32>* ItemIndices = PathItems.Find(PackagePath))
+	{
+		return *ItemIndices;
+	}
+
+	TArray<int32>& ItemIndices = PathItems.Add(PackagePath);
+	IndexPath(PackagePath, ItemIndices);
+	return ItemIndices;
+}
+
+// Complete the data of the item with its loaded mesh
+void GraspableItemIndex::UpdateLoadedItem(const int32 ItemIndex, const UStaticMesh* Mesh)
+{
+	if (!Items.IsValidIndex(ItemIndex) || !Mesh) return;
+
+	FGraspableItemInfo& Item = Items[ItemIndex];
+	Item.BoundsExtent = Mesh->GetBoundingBox().GetExtent();
+	if (Mesh->BodySetup)
+	{
+		Item.Mass = Mesh->BodySetup->CalculateMass();
+	}
+}
+
+// Drop the index
+void GraspableItemIndex::Invalidate()
+{
+	Items.Empty();
+	PathItems.Empty();
+}
+
+// Query the items of the package path from the asset registry
+void GraspableItemIndex::IndexPath(const FString& PackagePath, TArray<int32>& OutItemIndices)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// In the editor the registry may still be discovering the assets
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		AssetRegistry.ScanPathsSynchronous({ PackagePath });
+	}
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(*PackagePath));
+	Filter.ClassNames.Add(UStaticMesh::StaticClass()->GetFName());
+	Filter.bRecursivePaths = false;
+
+	TArray<FAssetData> AssetDatas;
+	AssetRegistry.GetAssets(Filter, AssetDatas);
+
+	OutItemIndices.Reserve(AssetDatas.Num());
+	for (const FAssetData& AssetData : AssetDatas)
+	{
+		FGraspableItemInfo Item;
+		Item.MeshPath = AssetData.ToSoftObjectPath();
+		Item.Name = AssetData.AssetName;
+		for (const auto& Tag : AssetData.TagsAndValues)
+		{
+			Item.Tags.Add(Tag.Key, Tag.Value);
+		}
+
+		// The static mesh registers its bounding box size as "XxYxZ"
+		if (const FString* ApproxSize = Item.Tags.Find(TEXT("ApproxSize")))
+		{
+			TArray<FString> Sizes;
+			if (ApproxSize->ParseIntoArray(Sizes, TEXT("x")) == 3)
+			{
+				Item.BoundsExtent = 0.5f * FVector(FCString::Atof(*Sizes[0]), FCString::Atof(*Sizes[1]), FCString::Atof(*Sizes[2]));
+			}
+		}
+
+		OutItemIndices.Add(Items.Add(Item));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("GraspableItemIndex: %i items in %s"), OutItemIndices.Num(), *PackagePath);
+}
@@ -0,0 +1,63 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+class UStaticMesh;
+
+// Indexed data of a graspable item mesh, available without loading it
+struct FGraspableItemInfo
+{
+	FGraspableItemInfo() :
+		BoundsExtent(FVector::ZeroVector),
+		Mass(-1.0f)
+	{}
+
+	// Path of the static mesh
+	FSoftObjectPath MeshPath;
+
+	// Name of the mesh asset
+	FName Name;
+
+	// Half size of the bounding box (cm), approximated by the asset registry until the mesh has been loaded
+	FVector BoundsExtent;
+
+	// Mass of the mesh (kg), negative until the mesh has been loaded
+	float Mass;
+
+	// Asset registry tags of the mesh
+	TMap<FName, FString> Tags;
+};
+
+/**
+ * Index of the item meshes of content folders, queried from the asset registry
+ * (in memory in cooked builds), no file system scan or loading is needed.
+ * The folders are indexed once and shared by all users, the data of loaded meshes is completed on load.
+ */
+class UFORCEBASEDGRASPING_API GraspableItemIndex
+{
+public:
+	// Get the indices of the items of the package path (e.g. /Game/Items/Scanned/Meshes), indexes the path on first use
+	static const TArray<int32>& GetItemsInPath(const FString& PackagePath);
+
+	// Indexed data of the item
+	static const FGraspableItemInfo& GetItem(const int32 ItemIndex) { return Items[ItemIndex]; };
+
+	// Complete the data of the item with its loaded mesh (exact bounds and mass)
+	static void UpdateLoadedItem(const int32 ItemIndex, const UStaticMesh* Mesh);
+
+	// Drop the index, e.g. after assets have been added
+	static void Invalidate();
+
+private:
+	// Query the items of the package path from the asset registry
+	static void IndexPath(const FString& PackagePath, TArray<int32>& OutItemIndices);
+
+	// Indexed items
+	static TArray<FGraspableItemInfo> Items;
+
+	// Item indices by package path
+	static TMap<FString, TArray<int32>> PathItems;
+};
@@ -0,0 +1,99 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "GraspableObjectRegistry.h"
+#include "Hand.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
+
+TMap<TWeakObjectPtr<AActor>, FGraspableObjectInfo> GraspableObjectRegistry::Infos;
+
+const FGraspableObjectInfo* GraspableObjectRegistry::Get(AActor* InActor, const FGraspabilityLimits& Limits)
+{
+	check(IsInGameThread());
+
+	const AStaticMeshActor* const SMActor = Cast<AStaticMeshActor>(InActor);
+	if (!SMActor || !SMActor->GetStaticMeshComponent())
+		return nullptr;
+
+	FGraspableObjectInfo* Info = Infos.Find(InActor);
+	if (!Info)
+	{
+		// Drop the data of destroyed actors before adding a new one
+		for (auto InfoItr = Infos.CreateIterator(); InfoItr; ++InfoItr)
+		{
+			if (!InfoItr.Key().IsValid())
+			{
+				InfoItr.RemoveCurrent();
+			}
+		}
+		Info = &Infos.Add(InActor);
+		Compute(*Info, SMActor, Limits);
+	}
+	else if (!IsUpToDate(*Info, SMActor))
+	{
+		Compute(*Info, SMActor, Limits);
+	}
+	else if (!(Info->Limits == Limits))
+	{
+		Classify(*Info, Limits);
+	}
+	return Info;
+}
+
+void GraspableObjectRegistry::Invalidate(AActor* InActor)
+{
+	Infos.Remove(InActor);
+}
+
+bool GraspableObjectRegistry::IsUpToDate(const FGraspableObjectInfo& Info, const AStaticMeshActor* SMActor)
+{
+	const UStaticMeshComponent* const SMComp = SMActor->GetStaticMeshComponent();
+	return Info.Mesh.Get() == SMComp->GetStaticMesh()
+		&& Info.Scale.Equals(SMComp->GetComponentScale())
+		&& Info.MassScale == SMComp->BodyInstance.MassScale
+		&& Info.bSimulatePhysics == SMComp->IsSimulatingPhysics()
+		&& Info.bMovable == SMActor->IsRootComponentMovable();
+}
+
+void GraspableObjectRegistry::Compute(FGraspableObjectInfo& OutInfo, const AStaticMeshActor* SMActor, const FGraspabilityLimits& Limits)
+{
+	UStaticMeshComponent* const SMComp = SMActor->GetStaticMeshComponent();
+	UStaticMesh* const Mesh = SMComp->GetStaticMesh();
+
+	OutInfo.Mesh = Mesh;
+	OutInfo.Scale = SMComp->GetComponentScale();
+	OutInfo.MassScale = SMComp->BodyInstance.MassScale;
+	OutInfo.bSimulatePhysics = SMComp->IsSimulatingPhysics();
+	OutInfo.bMovable = SMActor->IsRootComponentMovable();
+
+	// Local bounds are independent of the rotation of the object
+	OutInfo.Mass = SMComp->GetMass();
+	const FBox LocalBox = Mesh ? Mesh->GetBoundingBox() : FBox(ForceInitToZero);
+	OutInfo.BoundsOrigin = LocalBox.GetCenter();
+	OutInfo.BoundsExtent = LocalBox.GetExtent() * OutInfo.Scale.GetAbs();
+	OutInfo.Length = OutInfo.BoundsExtent.Size() * 2.0f;
+
+	Classify(OutInfo, Limits);
+}
+
+void GraspableObjectRegistry::Classify(FGraspableObjectInfo& OutInfo, const FGraspabilityLimits& Limits)
+{
+	OutInfo.Limits = Limits;
+	OutInfo.GraspableType = NOT_GRASPABLE;
+
+	// Check that actor is movable, has physics on, and has one hand graspable dimensions
+	if (OutInfo.bMovable &&
+		OutInfo.bSimulatePhysics &&
+		OutInfo.Mass < Limits.OneHandMaxMass &&
+		OutInfo.Length < Limits.OneHandMaxLength)
+	{
+		OutInfo.GraspableType = ONE_HAND_GRASPABLE;
+	}
+	// check for two hand graspable dimensions
+	else if (OutInfo.Mass < Limits.TwoHandsMaxMass &&
+		OutInfo.Length < Limits.TwoHandsMaxLength)
+	{
+		OutInfo.GraspableType = TWO_HANDS_GRASPABLE;
+	}
+}
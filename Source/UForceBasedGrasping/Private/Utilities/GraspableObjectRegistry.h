@@ -0,0 +1,110 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class AStaticMeshActor;
+class UStaticMesh;
+
+// Mass (kg) and length (cm) limits of the fixation grasp
+struct FGraspabilityLimits
+{
+	FGraspabilityLimits() :
+		OneHandMaxMass(0.0f),
+		OneHandMaxLength(0.0f),
+		TwoHandsMaxMass(0.0f),
+		TwoHandsMaxLength(0.0f)
+	{}
+
+	float OneHandMaxMass;
+	float OneHandMaxLength;
+	float TwoHandsMaxMass;
+	float TwoHandsMaxLength;
+
+	FORCEINLINE bool operator==(const FGraspabilityLimits& Other) const
+	{
+		return OneHandMaxMass == Other.OneHandMaxMass
+			&& OneHandMaxLength == Other.OneHandMaxLength
+			&& TwoHandsMaxMass == Other.TwoHandsMaxMass
+			&& TwoHandsMaxLength == Other.TwoHandsMaxLength;
+	}
+};
+
+// Cached graspability data of an object
+struct FGraspableObjectInfo
+{
+	FGraspableObjectInfo() :
+		Mass(0.0f),
+		BoundsOrigin(FVector::ZeroVector),
+		BoundsExtent(FVector::ZeroVector),
+		Length(0.0f),
+		GraspableType(0),
+		Scale(FVector::OneVector),
+		MassScale(1.0f),
+		bSimulatePhysics(false),
+		bMovable(false)
+	{}
+
+	// Mass of the object (kg)
+	float Mass;
+
+	// Center of the local bounding box, unscaled (cm)
+	FVector BoundsOrigin;
+
+	// Half size of the local bounding box, scaled (cm)
+	FVector BoundsExtent;
+
+	// Diagonal of the scaled bounding box (cm)
+	float Length;
+
+	// Number of hands needed to grasp the object (NOT_GRASPABLE, ONE_HAND_GRASPABLE, TWO_HANDS_GRASPABLE)
+	uint8 GraspableType;
+
+	// Limits used for the classification
+	FGraspabilityLimits Limits;
+
+	// Static mesh the data was computed from
+	TWeakObjectPtr<UStaticMesh> Mesh;
+
+	// World scale the data was computed from
+	FVector Scale;
+
+	// Mass scale the data was computed from
+	float MassScale;
+
+	// Physics simulation state the data was computed from
+	bool bSimulatePhysics;
+
+	// Mobility the data was computed from
+	bool bMovable;
+};
+
+/**
+ * Caches the graspability of objects, so overlaps do not recompute masses and bounding boxes.
+ * An entry is only recomputed if the mesh, the scale or the physics of the object change.
+ */
+class UFORCEBASEDGRASPING_API GraspableObjectRegistry
+{
+public:
+	// Get the (cached) graspability of the actor, nullptr if it is not a static mesh actor
+	static const FGraspableObjectInfo* Get(AActor* InActor, const FGraspabilityLimits& Limits);
+
+	// Force recomputing the data of the actor on the next query
+	static void Invalidate(AActor* InActor);
+
+private:
+	// Check if the cached data still matches the object
+	static bool IsUpToDate(const FGraspableObjectInfo& Info, const AStaticMeshActor* SMActor);
+
+	// Compute the graspability data of the object
+	static void Compute(FGraspableObjectInfo& OutInfo, const AStaticMeshActor* SMActor, const FGraspabilityLimits& Limits);
+
+	// Classify the object with the given limits
+	static void Classify(FGraspableObjectInfo& OutInfo, const FGraspabilityLimits& Limits);
+
+	// Cached data of all queried objects
+	static TMap<TWeakObjectPtr<AActor>, FGraspableObjectInfo> Infos;
+};
@@ -1,244 +1,418 @@
-// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
-
-#include "GraspingGame.h"
-#include "Paths.h"
-#include "FileManagerGeneric.h"
-#include "TimerManager.h"
-#include "Engine/World.h"
-#include "Components/InputComponent.h"
-#include "GameFramework/PlayerController.h"
-#include "GameFramework/Character.h"
-#include "Engine/StaticMesh.h"
-
-
-// Sets default values
-AGraspingGame::AGraspingGame()
-{
-	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
-
-	bGameRunning = false;
-	bRoundSuccessfulFinished = false;
-
-	CharacterStartTransform = FTransform();
-
-	CurrentItemName = "";
-	Paths.Add("Items/Scanned/Meshes");
-
-	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
-
-	SpawnedMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("SpawnedMesh"));
-	SpawnedMesh->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
-
-	TimerText = CreateDefaultSubobject<UTextRenderComponent>(TEXT("CountdownNumber"));
-	TimerText->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
-	TimerText->SetText(FText::FromName("Countdown!"));
-	TimerText->SetHorizontalAlignment(EHTA_Center);
-	TimerText->SetWorldSize(50.0f);
-
-	StartTime = 3;
-}
-
-// Called when the game starts or when spawned
-void AGraspingGame::BeginPlay()
-{
-	UE_LOG(LogTemp, Warning, TEXT("BEGIN"));
-	Super::BeginPlay();
-
-	if (TargetBox) {
-		TargetBox->OnActorBeginOverlap.AddDynamic(this, &AGraspingGame::ActorOverlaped);
-	}
-
-	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
-	if (PlayerController)
-	{
-		EnableInput(PlayerController);
-		InputComponent->BindAction("GameControl", IE_Pressed, this, &AGraspingGame::ControlGame);
-		CharacterStartTransform = PlayerController->GetActorTransform();
-	}
-
-	FString AbsolutePath = "";
-	auto ContentFolder = FPaths::GameContentDir();
-
-	for (auto && Path : Paths)
-	{
-		AbsolutePath = ContentFolder + Path;
-		GetAllAssetsInFolder(AbsolutePath, Items);
-	}
-
-}
-
-// Called every frame
-void AGraspingGame::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
-void AGraspingGame::GetAllAssetsInFolder(const FString & Directory, TArray<FString> & Assets)
-{
-	UE_LOG(LogTemp, Warning, TEXT("Directory: %s"), *Directory);
-	if (FPaths::DirectoryExists(Directory))
-	{
-		auto Path = Directory + "/*.uasset";
-		FFileManagerGeneric::Get().FindFiles(Assets, *Path, true, false);
-		for (auto & Asset : Assets)
-		{
-			Asset = Directory + "/" + Asset;
-		}
-	}
-
-	UE_LOG(LogTemp, Warning, TEXT("Found Assets: %i"), Assets.Num());
-	AbsoluteToGamePath(Assets);
-}
-
-void AGraspingGame::AbsoluteToGamePath(TArray<FString> & Assets)
-{
-	if (Assets.Num() <= 0) return;
-
-	FString MeshName = "";
-	FString Left = "";
-
-	auto LastSlashIndex = 0;
-	auto LastPointIndex = 0;
-
-	for (auto & Asset : Assets)
-	{
-		// Path to "/Game"
-		Left = Asset.Left(Asset.Find("Content") + 7);
-		Asset = Asset.Replace(*Left, *FString("/Game"));
-
-		// Change "*.uasset" filename to "name.name"
-		Asset.FindLastChar('/', LastSlashIndex);
-		Asset.FindLastChar('.', LastPointIndex);
-
-		MeshName = Asset.Mid(LastSlashIndex + 1, LastPointIndex - (LastSlashIndex + 1));
-
-		Asset = "StaticMesh'" + Asset.Left(LastSlashIndex) + "/" + MeshName + "." + MeshName + "'";
-		UE_LOG(LogTemp, Warning, TEXT("PathName: %s"), *Asset);
-	}
-}
-
-void AGraspingGame::SpawnRandomItem(TArray<FString> & Assets)
-{
-	if (Assets.Num() <= 0) return;
-
-	int32 RandomIndex = FMath::RandRange(0, Assets.Num() - 1);
-	FString MeshPath = Assets[RandomIndex];
-
-
-	UStaticMesh* Mesh = Cast<UStaticMesh>(StaticLoadObject(UStaticMesh::StaticClass(), nullptr, *MeshPath));
-
-	if (Mesh) {
-
-		auto SlashPosition = 0;
-		auto PointPosition = 0;
-		MeshPath.FindLastChar('/', SlashPosition);
-		MeshPath.FindLastChar('.', PointPosition);
-
-		CurrentItemName = MeshPath.Mid(SlashPosition + 1, PointPosition - (SlashPosition + 1));
-		SpawnedMesh->SetStaticMesh(Mesh);
-		SpawnedMesh->SetEnableGravity(true);
-		SpawnedMesh->SetSimulatePhysics(true);
-		SpawnedMesh->bGenerateOverlapEvents = true;
-	}
-	if (SpawningBox)
-	{
-		SpawnedMesh->SetWorldRotation(FRotator(0, 0, 0), false, nullptr, ETeleportType::TeleportPhysics);
-		SpawnedMesh->SetWorldLocation(SpawningBox->GetActorLocation(), false, nullptr, ETeleportType::TeleportPhysics);
-	}
-}
-
-void AGraspingGame::ControlGame()
-{
-	//UE_LOG(LogTemp, Warning, TEXT("ControlGame"));
-	if (bGameRunning)
-	{
-		ResetGame();
-	}
-	else
-	{
-		StartGame();
-		bGameRunning = true;
-	}
-}
-
-void AGraspingGame::StartGame()
-{
-	//UE_LOG(LogTemp, Warning, TEXT("StartGame"));
-	TimerText->SetText(FText::AsNumber(FMath::Max(StartTime, 0)));
-	bRoundSuccessfulFinished = false;
-	GetWorldTimerManager().SetTimer(StartTimerHandle, this, &AGraspingGame::UpdateStartTimer, 1.0f, true);
-}
-
-void AGraspingGame::StopGame()
-{
-}
-
-void AGraspingGame::ResetGame()
-{
-	//UE_LOG(LogTemp, Warning, TEXT("ResetGame"));
-	//ResetCharacterTransform();
-	StartGame();
-}
-
-void AGraspingGame::ResetCharacterTransform()
-{
-	UE_LOG(LogTemp, Warning, TEXT("ResetCharacterTransform"));
-	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
-	if (PlayerController)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("StartTrans: %s | CurrentTrans: %s"), *CharacterStartTransform.ToString(), *PlayerController->GetActorTransform().ToString());
-		PlayerController->GetCharacter()->SetActorTransform(CharacterStartTransform, false, nullptr, ETeleportType::TeleportPhysics);
-	}
-}
-
-void AGraspingGame::UpdateStartTimer()
-{
-	//UE_LOG(LogTemp, Warning, TEXT("UpdateStartTimer"));
-
-	--StartTime;
-	TimerText->SetText(FText::AsNumber(FMath::Max(StartTime, 0)));
-	if (StartTime < 1)
-	{
-		// We're done counting down, so stop running the timer.
-		GetWorldTimerManager().ClearTimer(StartTimerHandle);
-		//Perform any special actions we want to do when the timer ends.
-		StartTimerHasFinished();
-	}
-}
-
-void AGraspingGame::StartTimerHasFinished()
-{
-	//UE_LOG(LogTemp, Warning, TEXT("StartTimerHasFinished"));
-	//Change to a special readout
-	SpawnRandomItem(Items);
-	TimerText->SetText(FText::FromString("Round Running"));
-	TimerText->SetText(FText::AsNumber(FMath::Max(StartTime, 0)));
-	StartTime = 3;
-	//GetWorldTimerManager().SetTimer(GameTimerHandle, this, &AGraspingGame::UpdateGameTimer, 0.1f, true);
-	bGameRunning = true;
-}
-
-void AGraspingGame::ActorOverlaped(AActor* OverlappedActor, AActor* OtherActor)
-{
-	UE_LOG(LogTemp, Warning, TEXT("ActorOverlapped: %s - %s - %s"), *OtherActor->GetName(), *OverlappedActor->GetName(), *SpawnedMesh->GetName());
-
-	AGraspingGame* GraspingGame = Cast<AGraspingGame>(OtherActor);
-	if (GraspingGame) {
-		UE_LOG(LogTemp, Warning, TEXT("Cast Okay: CurrentItemNameCast: %s - CurrentItemName: %s"), *GraspingGame->CurrentItemName, *CurrentItemName);
-
-		if(GraspingGame->CurrentItemName.Equals(CurrentItemName))
-		{
-			bRoundSuccessfulFinished = true;
-			//Perform any special actions we want to do when the timer ends.
-			RoundFinished();
-		}
-	}
-}
-
-void AGraspingGame::RoundFinished()
-{
-	UE_LOG(LogTemp, Warning, TEXT("RoundFinished"));
-	bGameRunning = false;
-	TimerText->SetText(FText::FromName("Round Finished. <br> Press SPACE to reload"));
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "GraspingGame.h"
+#include "GraspableItemIndex.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+#include "Components/InputComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Character.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("GraspingGame"), STATGROUP_GraspingGame, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Item load time (ms)"), STAT_ItemLoadTime, STATGROUP_GraspingGame);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Item ready before spawn (ms)"), STAT_ItemReadyBeforeSpawn, STATGROUP_GraspingGame);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Item spawn stall (ms)"), STAT_ItemSpawnStall, STATGROUP_GraspingGame);
+
+
+// Sets default values
+AGraspingGame::AGraspingGame()
+{
+	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	PrimaryActorTick.bCanEverTick = true;
+
+	bGameRunning = false;
+	bRoundSuccessfulFinished = false;
+
+	CharacterStartTransform = FTransform();
+
+	CurrentItemName = "";
+	Paths.Add("Items/Scanned/Meshes");
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	TimerText = CreateDefaultSubobject<UTextRenderComponent>(TEXT("CountdownNumber"));
+	TimerText->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+	TimerText->SetText(FText::FromName("Countdown!"));
+	TimerText->SetHorizontalAlignment(EHTA_Center);
+	TimerText->SetWorldSize(50.0f);
+
+	StartTime = 3;
+
+	ItemPoolSize = 8;
+	CurrentItemActor = nullptr;
+	NextItem = INDEX_NONE;
+	NextItemRequest = 0;
+	bNextItemLoaded = false;
+	bNextItemReady = false;
+	bSpawnPending = false;
+	SpawnStallStartTime = 0.0;
+	NextItemRequestTime = 0.0;
+	NextItemReadyTime = 0.0;
+	NumSpawnedItems = 0;
+	NumStalledSpawns = 0;
+}
+
+// Called when the game starts or when spawned
+void AGraspingGame::BeginPlay()
+{
+	UE_LOG(LogTemp, Warning, TEXT("BEGIN"));
+	Super::BeginPlay();
+
+	if (TargetBox) {
+		TargetBox->OnActorBeginOverlap.AddDynamic(this, &AGraspingGame::ActorOverlaped);
+	}
+
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (PlayerController)
+	{
+		EnableInput(PlayerController);
+		InputComponent->BindAction("GameControl", IE_Pressed, this, &AGraspingGame::ControlGame);
+		CharacterStartTransform = PlayerController->GetActorTransform();
+	}
+
+	// Items of the content folders, from the (cached) asset registry index
+	for (auto && Path : Paths)
+	{
+		Items.Append(GraspableItemIndex::GetItemsInPath(TEXT("/Game/") + Path));
+	}
+	UE_LOG(LogTemp, Log, TEXT("GraspingGame: %i items"), Items.Num());
+
+	// Load the first item while the player gets ready
+	PrefetchRandomItem(Items);
+}
+
+// Called when the game ends
+void AGraspingGame::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	if (NextItemHandle.IsValid())
+	{
+		NextItemHandle->CancelHandle();
+		NextItemHandle.Reset();
+	}
+	CurrentItemHandle.Reset();
+	// Ignore a physics cook still in flight
+	++NextItemRequest;
+	bSpawnPending = false;
+
+	for (auto& PoolPair : ItemPool)
+	{
+		if (PoolPair.Value)
+		{
+			PoolPair.Value->Destroy();
+		}
+	}
+	ItemPool.Empty();
+	ItemPoolOrder.Empty();
+	CurrentItemActor = nullptr;
+
+	UE_LOG(LogTemp, Log, TEXT("GraspingGame: %i items spawned, %i spawns waited for the loading"), NumSpawnedItems, NumStalledSpawns);
+}
+
+// Called every frame
+void AGraspingGame::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+}
+
+void AGraspingGame::PrefetchRandomItem(const TArray<int32> & ItemIndices)
+{
+	if (ItemIndices.Num() <= 0) return;
+
+	int32 RandomIndex = FMath::RandRange(0, ItemIndices.Num() - 1);
+	NextItem = ItemIndices[RandomIndex];
+	NextItemPath = GraspableItemIndex::GetItem(NextItem).MeshPath.ToString();
+	++NextItemRequest;
+	bNextItemLoaded = false;
+	bNextItemReady = false;
+	NextItemRequestTime = FPlatformTime::Seconds();
+
+	NextItemHandle = StreamableManager.RequestAsyncLoad(GraspableItemIndex::GetItem(NextItem).MeshPath,
+		FStreamableDelegate::CreateUObject(this, &AGraspingGame::NextItemLoaded, NextItemRequest), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void AGraspingGame::NextItemLoaded(int32 Request)
+{
+	// Stale request, or already handled by a stalled spawn
+	if (Request != NextItemRequest || bNextItemLoaded) return;
+	bNextItemLoaded = true;
+
+	UStaticMesh* Mesh = NextItemHandle.IsValid() ? Cast<UStaticMesh>(NextItemHandle->GetLoadedAsset()) : nullptr;
+	if (!Mesh)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GraspingGame: Could not load %s"), *NextItemPath);
+		NextItemPhysicsCreated(false, Request);
+		return;
+	}
+	GraspableItemIndex::UpdateLoadedItem(NextItem, Mesh);
+
+	// Create the physics meshes off the game thread as well, so the physics state is created without cooking on spawn
+	UBodySetup* BodySetup = Mesh->BodySetup;
+	if (BodySetup && !BodySetup->bCreatedPhysicsMeshes)
+	{
+		BodySetup->CreatePhysicsMeshesAsync(FOnAsyncPhysicsCookFinished::CreateUObject(this, &AGraspingGame::NextItemPhysicsCreated, Request));
+		return;
+	}
+	NextItemPhysicsCreated(true, Request);
+}
+
+void AGraspingGame::NextItemPhysicsCreated(bool bSuccess, int32 Request)
+{
+	if (Request != NextItemRequest) return;
+	bNextItemReady = true;
+	NextItemReadyTime = FPlatformTime::Seconds();
+
+	const float LoadTimeMs = (NextItemReadyTime - NextItemRequestTime) * 1000.0;
+	SET_FLOAT_STAT(STAT_ItemLoadTime, LoadTimeMs);
+	UE_LOG(LogTemp, Log, TEXT("GraspingGame: %s resident after %.1f ms"), *NextItemPath, LoadTimeMs);
+
+	// Create the physics body during the countdown, the round only activates it
+	UStaticMesh* Mesh = NextItemHandle.IsValid() ? Cast<UStaticMesh>(NextItemHandle->GetLoadedAsset()) : nullptr;
+	if (Mesh)
+	{
+		GetPooledItem(NextItem, Mesh);
+	}
+
+	// The round started while cooking, spawn now (as a stalled spawn) and load the item of the next round
+	if (bSpawnPending)
+	{
+		if (SpawnNextItem())
+		{
+			PrefetchRandomItem(Items);
+		}
+	}
+}
+
+bool AGraspingGame::SpawnNextItem()
+{
+	if (!NextItemHandle.IsValid()) return true;
+
+	// The countdown was shorter than the loading, finish the mesh loading now,
+	// a spawn deferred to the cook callback is still pending here and counts as stalled
+	const bool bStalled = bSpawnPending || !bNextItemReady;
+	if (!bNextItemReady)
+	{
+		if (!bSpawnPending)
+		{
+			SpawnStallStartTime = FPlatformTime::Seconds();
+			++NumStalledSpawns;
+		}
+		NextItemHandle->WaitUntilComplete();
+		NextItemLoaded(NextItemRequest);
+
+		// Never cook synchronously next to the async cook, the spawn follows its callback
+		if (!bNextItemReady)
+		{
+			bSpawnPending = true;
+			UE_LOG(LogTemp, Warning, TEXT("GraspingGame: %s was not resident at the spawn, waiting for its physics meshes"), *NextItemPath);
+			return false;
+		}
+	}
+	bSpawnPending = false;
+	const float StallTimeMs = bStalled ? (FPlatformTime::Seconds() - SpawnStallStartTime) * 1000.0 : 0.0f;
+	if (bStalled)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GraspingGame: %s was not resident at the spawn, waited %.1f ms"), *NextItemPath, StallTimeMs);
+	}
+	SET_FLOAT_STAT(STAT_ItemSpawnStall, StallTimeMs);
+	SET_FLOAT_STAT(STAT_ItemReadyBeforeSpawn, bStalled ? 0.0 : (FPlatformTime::Seconds() - NextItemReadyTime) * 1000.0);
+
+	// The spawned item keeps its handle, the mesh stays loaded until the next one replaces it
+	CurrentItemHandle = NextItemHandle;
+	NextItemHandle.Reset();
+	UStaticMesh* Mesh = Cast<UStaticMesh>(CurrentItemHandle->GetLoadedAsset());
+
+	if (Mesh) {
+		++NumSpawnedItems;
+		CurrentItemName = GraspableItemIndex::GetItem(NextItem).Name.ToString();
+
+		AStaticMeshActor* ItemActor = GetPooledItem(NextItem, Mesh);
+		if (CurrentItemActor && CurrentItemActor != ItemActor)
+		{
+			DeactivateItem(CurrentItemActor);
+		}
+		CurrentItemActor = ItemActor;
+
+		const FVector SpawnLocation = SpawningBox ? SpawningBox->GetActorLocation() : GetActorLocation();
+		ActivateItem(CurrentItemActor, FTransform(FRotator(0, 0, 0), SpawnLocation));
+	}
+	return true;
+}
+
+AStaticMeshActor* AGraspingGame::GetPooledItem(const int32 ItemIndex, UStaticMesh* Mesh)
+{
+	ItemPoolOrder.Remove(ItemIndex);
+	ItemPoolOrder.Add(ItemIndex);
+
+	AStaticMeshActor** PooledItem = ItemPool.Find(ItemIndex);
+	if (PooledItem && *PooledItem)
+	{
+		return *PooledItem;
+	}
+
+	// Drop the least recently used items, except the spawned one
+	for (int32 OrderIndex = 0; ItemPool.Num() >= ItemPoolSize && OrderIndex < ItemPoolOrder.Num() - 1; )
+	{
+		AStaticMeshActor* const OldItem = ItemPool.FindRef(ItemPoolOrder[OrderIndex]);
+		if (OldItem && OldItem == CurrentItemActor)
+		{
+			++OrderIndex;
+			continue;
+		}
+		if (OldItem)
+		{
+			OldItem->Destroy();
+		}
+		ItemPool.Remove(ItemPoolOrder[OrderIndex]);
+		ItemPoolOrder.RemoveAt(OrderIndex);
+	}
+
+	const FVector ParkingLocation = SpawningBox ? SpawningBox->GetActorLocation() : GetActorLocation();
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.bDeferConstruction = true;
+	AStaticMeshActor* ItemActor = GetWorld()->SpawnActor<AStaticMeshActor>(ParkingLocation, FRotator::ZeroRotator, SpawnParameters);
+	if (!ItemActor) return nullptr;
+
+	UStaticMeshComponent* ItemMesh = ItemActor->GetStaticMeshComponent();
+	ItemActor->SetMobility(EComponentMobility::Movable);
+	ItemMesh->SetStaticMesh(Mesh);
+	// The physics body is created with the component and kept while the collision is disabled
+	ItemMesh->bAlwaysCreatePhysicsState = true;
+	ItemMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ItemMesh->SetEnableGravity(true);
+	ItemMesh->bGenerateOverlapEvents = true;
+	ItemActor->SetActorHiddenInGame(true);
+	ItemActor->FinishSpawning(FTransform(FRotator::ZeroRotator, ParkingLocation));
+
+	ItemPool.Add(ItemIndex, ItemActor);
+	return ItemActor;
+}
+
+void AGraspingGame::ActivateItem(AStaticMeshActor* ItemActor, const FTransform& Transform)
+{
+	if (!ItemActor) return;
+
+	UStaticMeshComponent* ItemMesh = ItemActor->GetStaticMeshComponent();
+	// Reset the physics state of the last round
+	ItemMesh->SetSimulatePhysics(false);
+	ItemActor->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+	ItemMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	ItemMesh->SetSimulatePhysics(true);
+	ItemMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
+	ItemMesh->SetPhysicsAngularVelocity(FVector::ZeroVector);
+	ItemActor->SetActorHiddenInGame(false);
+}
+
+void AGraspingGame::DeactivateItem(AStaticMeshActor* ItemActor)
+{
+	if (!ItemActor) return;
+
+	UStaticMeshComponent* ItemMesh = ItemActor->GetStaticMeshComponent();
+	ItemMesh->SetSimulatePhysics(false);
+	ItemMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ItemActor->SetActorHiddenInGame(true);
+}
+
+void AGraspingGame::ControlGame()
+{
+	//UE_LOG(LogTemp, Warning, TEXT("ControlGame"));
+	if (bGameRunning)
+	{
+		ResetGame();
+	}
+	else
+	{
+		StartGame();
+		bGameRunning = true;
+	}
+}
+
+void AGraspingGame::StartGame()
+{
+	//UE_LOG(LogTemp, Warning, TEXT("StartGame"));
+	TimerText->SetText(FText::AsNumber(FMath::Max(StartTime, 0)));
+	bRoundSuccessfulFinished = false;
+	// The item of the round loads during the countdown
+	if (!NextItemHandle.IsValid())
+	{
+		PrefetchRandomItem(Items);
+	}
+	GetWorldTimerManager().SetTimer(StartTimerHandle, this, &AGraspingGame::UpdateStartTimer, 1.0f, true);
+}
+
+void AGraspingGame::StopGame()
+{
+}
+
+void AGraspingGame::ResetGame()
+{
+	//UE_LOG(LogTemp, Warning, TEXT("ResetGame"));
+	//ResetCharacterTransform();
+	StartGame();
+}
+
+void AGraspingGame::ResetCharacterTransform()
+{
+	UE_LOG(LogTemp, Warning, TEXT("ResetCharacterTransform"));
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (PlayerController)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StartTrans: %s | CurrentTrans: %s"), *CharacterStartTransform.ToString(), *PlayerController->GetActorTransform().ToString());
+		PlayerController->GetCharacter()->SetActorTransform(CharacterStartTransform, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+}
+
+void AGraspingGame::UpdateStartTimer()
+{
+	//UE_LOG(LogTemp, Warning, TEXT("UpdateStartTimer"));
+
+	--StartTime;
+	TimerText->SetText(FText::AsNumber(FMath::Max(StartTime, 0)));
+	if (StartTime < 1)
+	{
+		// We're done counting down, so stop running the timer.
+		GetWorldTimerManager().ClearTimer(StartTimerHandle);
+		//Perform any special actions we want to do when the timer ends.
+		StartTimerHasFinished();
+	}
+}
+
+void AGraspingGame::StartTimerHasFinished()
+{
+	//UE_LOG(LogTemp, Warning, TEXT("StartTimerHasFinished"));
+	//Change to a special readout
+	// A stalled item is spawned by its physics cook callback, which then loads the next one
+	if (SpawnNextItem())
+	{
+		PrefetchRandomItem(Items);
+	}
+	TimerText->SetText(FText::FromString("Round Running"));
+	TimerText->SetText(FText::AsNumber(FMath::Max(StartTime, 0)));
+	StartTime = 3;
+	//GetWorldTimerManager().SetTimer(GameTimerHandle, this, &AGraspingGame::UpdateGameTimer, 0.1f, true);
+	bGameRunning = true;
+}
+
+void AGraspingGame::ActorOverlaped(AActor* OverlappedActor, AActor* OtherActor)
+{
+	UE_LOG(LogTemp, Warning, TEXT("ActorOverlapped: %s - %s - %s"), *OtherActor->GetName(), *OverlappedActor->GetName(), *CurrentItemName);
+
+	if (CurrentItemActor && OtherActor == CurrentItemActor)
+	{
+		bRoundSuccessfulFinished = true;
+		//Perform any special actions we want to do when the timer ends.
+		RoundFinished();
+	}
+}
+
+void AGraspingGame::RoundFinished()
+{
+	UE_LOG(LogTemp, Warning, TEXT("RoundFinished"));
+	bGameRunning = false;
+	TimerText->SetText(FText::FromName("Round Finished. <br> Press SPACE to reload"));
 }
\ No newline at end of file
@@ -1,115 +1,183 @@
-// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "Engine/TriggerBox.h"
-#include "Components/StaticMeshComponent.h"
-#include "Components/TextRenderComponent.h"
-
-#include "GraspingGame.generated.h"
-
-
-
-UCLASS()
-class UFORCEBASEDGRASPING_API AGraspingGame : public AActor
-{
-	GENERATED_BODY()
-
-public:
-
-	// The Paths to be scanned for Items
-	UPROPERTY(EditAnywhere)
-		TArray<FString> Paths;
-
-	// The Box in which the new Items are spawned
-	UPROPERTY(EditAnywhere)
-		ATriggerBox* SpawningBox;
-
-	// The Box in which the Items have to be placed
-	UPROPERTY(EditAnywhere)
-		ATriggerBox* TargetBox;
-
-	// The Name of the currently spawned item
-	FString CurrentItemName;
-
-	// Is the round successful finished
-	bool bRoundSuccessfulFinished;
-
-	// Sets default values for this actor's properties
-	AGraspingGame();
-
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
-protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
-
-private:
-	// Is a Game Running
-	bool bGameRunning;
-
-	
-	// The Start transform of the Character
-	FTransform CharacterStartTransform;
-
-	// All found Items to be found
-	TArray<FString> Items;
-
-	// The Spawned Mesh to be carried
-	UStaticMeshComponent* SpawnedMesh;
-
-	// How long, in seconds, the countdown will run
-	UPROPERTY(EditAnywhere, Category = "Timer")
-		int32 StartTime;
-
-	// The Text which is updated by the start timer
-	UPROPERTY(EditAnywhere, Category = "Timer")
-		UTextRenderComponent* TimerText;
-	
-	// The start countdown timer
-	FTimerHandle StartTimerHandle;
-
-	// The game timer to log the 
-	FTimerHandle GameTimerHandle;
-
-	// Updates the start timer
-	void UpdateStartTimer();
-
-	// Called when the start timer has finished
-	void StartTimerHasFinished();
-
-	// If an Actor Overlaps
-	UFUNCTION()
-		void ActorOverlaped(AActor* OverlappedActor, AActor* OtherActor);
-
-	// Called when the game tmer has finished
-	void RoundFinished();
-
-	// Writes all assetnames into a list
-	void GetAllAssetsInFolder(const FString & Directory, TArray<FString> & Assets);
-
-	// Absolute paths to ue4 valid loading paths
-	void AbsoluteToGamePath(TArray<FString> & Assets);
-
-	// Spawns a random item
-	void SpawnRandomItem(TArray<FString> & Assets);
-
-	// Reset the character to the base position
-	void ResetCharacterTransform();
-
-	// This method is called on the input
-	void ControlGame();
-
-	// Starts the game functionality
-	void StartGame();
-
-	// Stops the game functionality
-	void StopGame();
-
-	// Resets the game
-	void ResetGame();
-
-};
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Engine/TriggerBox.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/TextRenderComponent.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/StaticMeshActor.h"
+
+#include "GraspingGame.generated.h"
+
+
+
+UCLASS()
+class UFORCEBASEDGRASPING_API AGraspingGame : public AActor
+{
+	GENERATED_BODY()
+
+public:
+
+	// The content folders of the Items (relative to /Game)
+	UPROPERTY(EditAnywhere)
+		TArray<FString> Paths;
+
+	// The Box in which the new Items are spawned
+	UPROPERTY(EditAnywhere)
+		ATriggerBox* SpawningBox;
+
+	// The Box in which the Items have to be placed
+	UPROPERTY(EditAnywhere)
+		ATriggerBox* TargetBox;
+
+	// The Name of the currently spawned item
+	FString CurrentItemName;
+
+	// Is the round successful finished
+	bool bRoundSuccessfulFinished;
+
+	// Sets default values for this actor's properties
+	AGraspingGame();
+
+	// Called every frame
+	virtual void Tick(float DeltaTime) override;
+
+protected:
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+
+	// Called when the game ends
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	// Is a Game Running
+	bool bGameRunning;
+
+	
+	// The Start transform of the Character
+	FTransform CharacterStartTransform;
+
+	// All found Items (indices in the GraspableItemIndex)
+	TArray<int32> Items;
+
+	// Maximal number of pooled item actors, the least recently used are destroyed beyond it
+	UPROPERTY(EditAnywhere, Category = "Pool", meta = (ClampMin = 2))
+		int32 ItemPoolSize;
+
+	// Item actors with their physics bodies created, by item index
+	UPROPERTY()
+		TMap<int32, AStaticMeshActor*> ItemPool;
+
+	// Pooled item indices, least recently used first
+	TArray<int32> ItemPoolOrder;
+
+	// The spawned item to be carried
+	UPROPERTY()
+		AStaticMeshActor* CurrentItemActor;
+
+	// How long, in seconds, the countdown will run
+	UPROPERTY(EditAnywhere, Category = "Timer")
+		int32 StartTime;
+
+	// The Text which is updated by the start timer
+	UPROPERTY(EditAnywhere, Category = "Timer")
+		UTextRenderComponent* TimerText;
+	
+	// The start countdown timer
+	FTimerHandle StartTimerHandle;
+
+	// The game timer to log the 
+	FTimerHandle GameTimerHandle;
+
+	// Loads the items asynchronously
+	FStreamableManager StreamableManager;
+
+	// Loading handle of the next item
+	TSharedPtr<FStreamableHandle> NextItemHandle;
+
+	// Loading handle of the spawned item, keeps its mesh loaded
+	TSharedPtr<FStreamableHandle> CurrentItemHandle;
+
+	// Index of the next item in the GraspableItemIndex
+	int32 NextItem;
+
+	// Path of the next item
+	FString NextItemPath;
+
+	// Serial of the loading request of the next item, callbacks of older requests are ignored
+	int32 NextItemRequest;
+
+	// The mesh of the next item is loaded (its physics meshes may still be cooking)
+	bool bNextItemLoaded;
+
+	// The mesh and the physics meshes of the next item are resident
+	bool bNextItemReady;
+
+	// The spawn waits for the async cook of the physics meshes of the next item
+	bool bSpawnPending;
+
+	// Time the spawn started waiting for the loading (s)
+	double SpawnStallStartTime;
+
+	// Time the loading of the next item has been requested and finished (s)
+	double NextItemRequestTime;
+	double NextItemReadyTime;
+
+	// Number of spawned items and of spawns that had to wait for the loading
+	int32 NumSpawnedItems;
+	int32 NumStalledSpawns;
+
+	// Updates the start timer
+	void UpdateStartTimer();
+
+	// Called when the start timer has finished
+	void StartTimerHasFinished();
+
+	// If an Actor Overlaps
+	UFUNCTION()
+		void ActorOverlaped(AActor* OverlappedActor, AActor* OtherActor);
+
+	// Called when the game tmer has finished
+	void RoundFinished();
+
+	// Picks a random item and starts loading it asynchronously
+	void PrefetchRandomItem(const TArray<int32> & ItemIndices);
+
+	// Called when the mesh of the next item has been loaded
+	void NextItemLoaded(int32 Request);
+
+	// Called when the physics meshes of the next item have been created
+	void NextItemPhysicsCreated(bool bSuccess, int32 Request);
+
+	// Spawns the prefetched item, waits for its mesh loading if it is not resident yet,
+	// false if the spawn is deferred until the async cook of its physics meshes has finished
+	bool SpawnNextItem();
+
+	// Get the pooled actor of the item, creates it (deactivated, with its physics body) if needed
+	AStaticMeshActor* GetPooledItem(const int32 ItemIndex, UStaticMesh* Mesh);
+
+	// Show the item and simulate it at the transform
+	void ActivateItem(AStaticMeshActor* ItemActor, const FTransform& Transform);
+
+	// Hide the item and stop its simulation and collision, its physics body is kept
+	void DeactivateItem(AStaticMeshActor* ItemActor);
+
+	// Reset the character to the base position
+	void ResetCharacterTransform();
+
+	// This method is called on the input
+	void ControlGame();
+
+	// Starts the game functionality
+	void StartGame();
+
+	// Stops the game functionality
+	void StopGame();
+
+	// Resets the game
+	void ResetGame();
+
+};
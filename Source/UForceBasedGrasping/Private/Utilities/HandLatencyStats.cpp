@@ -0,0 +1,106 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "HandLatencyStats.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Pose to physics p50 (ms)"), STAT_PoseToPhysicsP50, STATGROUP_HandLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Pose to physics p95 (ms)"), STAT_PoseToPhysicsP95, STATGROUP_HandLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Pose to convergence p50 (ms)"), STAT_PoseToConvergenceP50, STATGROUP_HandLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Pose to convergence p95 (ms)"), STAT_PoseToConvergenceP95, STATGROUP_HandLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Trigger to physics p50 (ms)"), STAT_TriggerToPhysicsP50, STATGROUP_HandLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Trigger to physics p95 (ms)"), STAT_TriggerToPhysicsP95, STATGROUP_HandLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Trigger to contact p50 (ms)"), STAT_TriggerToContactP50, STATGROUP_HandLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Trigger to contact p95 (ms)"), STAT_TriggerToContactP95, STATGROUP_HandLatency);
+
+LatencyHistogram HandLatencyStats::PoseToPhysics;
+LatencyHistogram HandLatencyStats::PoseToConvergence;
+LatencyHistogram HandLatencyStats::TriggerToPhysics;
+LatencyHistogram HandLatencyStats::TriggerToContact;
+
+// Constructor
+LatencyHistogram::LatencyHistogram()
+{
+	LatencyHistogram::Reset();
+}
+
+// Add a latency sample (ms)
+void LatencyHistogram::AddSample(const float Milliseconds)
+{
+	const int32 Bin = FMath::Clamp(FMath::FloorToInt(Milliseconds), 0, NumBins - 1);
+	++Bins[Bin];
+	++NumSamples;
+	Sum += Milliseconds;
+	Max = FMath::Max(Max, Milliseconds);
+}
+
+// Latency below which the percentage of the samples lie (ms), the upper edge of the bin
+float LatencyHistogram::GetPercentile(const float Percentile) const
+{
+	if (NumSamples == 0) return 0.0f;
+
+	const int32 Rank = FMath::CeilToInt(FMath::Clamp(Percentile, 0.0f, 100.0f) / 100.0f * NumSamples);
+	int32 Count = 0;
+	for (int32 Bin = 0; Bin < NumBins; ++Bin)
+	{
+		Count += Bins[Bin];
+		if (Count >= Rank)
+		{
+			// The last bin has no upper edge
+			return Bin < NumBins - 1 ? FMath::Min(static_cast<float>(Bin + 1), Max) : Max;
+		}
+	}
+	return Max;
+}
+
+// Remove all samples
+void LatencyHistogram::Reset()
+{
+	FMemory::Memzero(Bins, sizeof(Bins));
+	NumSamples = 0;
+	Sum = 0.0;
+	Max = 0.0f;
+}
+
+// Summary of the samples
+FString LatencyHistogram::ToString() const
+{
+	return FString::Printf(TEXT("n=%d mean=%.1f p50=%.0f p90=%.0f p95=%.0f p99=%.0f max=%.1f ms"),
+		NumSamples, GetMean(), GetPercentile(50.0f), GetPercentile(90.0f), GetPercentile(95.0f), GetPercentile(99.0f), Max);
+}
+
+// Milliseconds between two timestamps of FPlatformTime::Cycles64
+float HandLatencyStats::CyclesToMilliseconds(const uint64 StartCycles, const uint64 EndCycles)
+{
+	return EndCycles > StartCycles ? static_cast<float>(FPlatformTime::ToSeconds64(EndCycles - StartCycles) * 1000.0) : 0.0f;
+}
+
+// Publish the percentiles to the stats
+void HandLatencyStats::UpdateStats()
+{
+	SET_FLOAT_STAT(STAT_PoseToPhysicsP50, PoseToPhysics.GetPercentile(50.0f));
+	SET_FLOAT_STAT(STAT_PoseToPhysicsP95, PoseToPhysics.GetPercentile(95.0f));
+	SET_FLOAT_STAT(STAT_PoseToConvergenceP50, PoseToConvergence.GetPercentile(50.0f));
+	SET_FLOAT_STAT(STAT_PoseToConvergenceP95, PoseToConvergence.GetPercentile(95.0f));
+	SET_FLOAT_STAT(STAT_TriggerToPhysicsP50, TriggerToPhysics.GetPercentile(50.0f));
+	SET_FLOAT_STAT(STAT_TriggerToPhysicsP95, TriggerToPhysics.GetPercentile(95.0f));
+	SET_FLOAT_STAT(STAT_TriggerToContactP50, TriggerToContact.GetPercentile(50.0f));
+	SET_FLOAT_STAT(STAT_TriggerToContactP95, TriggerToContact.GetPercentile(95.0f));
+}
+
+// Write all histograms to the log
+void HandLatencyStats::LogSession()
+{
+	UE_LOG(LogTemp, Log, TEXT("Hand latency, pose to physics: %s"), *PoseToPhysics.ToString());
+	UE_LOG(LogTemp, Log, TEXT("Hand latency, pose to convergence: %s"), *PoseToConvergence.ToString());
+	UE_LOG(LogTemp, Log, TEXT("Hand latency, trigger to physics: %s"), *TriggerToPhysics.ToString());
+	UE_LOG(LogTemp, Log, TEXT("Hand latency, trigger to contact: %s"), *TriggerToContact.ToString());
+}
+
+// Start a new session
+void HandLatencyStats::Reset()
+{
+	PoseToPhysics.Reset();
+	PoseToConvergence.Reset();
+	TriggerToPhysics.Reset();
+	TriggerToContact.Reset();
+}
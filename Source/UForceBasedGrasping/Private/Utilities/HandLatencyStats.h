@@ -0,0 +1,136 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("HandLatency"), STATGROUP_HandLatency, STATCAT_Advanced);
+
+/**
+ * Histogram of latency samples with 1 ms bins, the last bin collects all longer samples
+ */
+class UFORCEBASEDGRASPING_API LatencyHistogram
+{
+public:
+	// Constructor
+	LatencyHistogram();
+
+	// Add a latency sample (ms)
+	void AddSample(const float Milliseconds);
+
+	// Latency below which the percentage of the samples lie (ms), at bin resolution
+	float GetPercentile(const float Percentile) const;
+
+	// Number of samples
+	int32 GetNumSamples() const { return NumSamples; };
+
+	// Mean latency (ms)
+	float GetMean() const { return NumSamples > 0 ? static_cast<float>(Sum / NumSamples) : 0.0f; };
+
+	// Maximum latency (ms)
+	float GetMax() const { return Max; };
+
+	// Remove all samples
+	void Reset();
+
+	// Summary of the samples
+	FString ToString() const;
+
+private:
+	// Number of 1 ms bins
+	static const int32 NumBins = 1000;
+
+	// Samples per bin
+	int32 Bins[NumBins];
+
+	// Number of samples
+	int32 NumSamples;
+
+	// Sum of all samples (ms)
+	double Sum;
+
+	// Maximum sample (ms)
+	float Max;
+};
+
+// Open latency measurements of a hand
+struct FHandLatencyProbe
+{
+	FHandLatencyProbe() :
+		bPoseTargetValid(false),
+		bPoseProbeOpen(false),
+		bPoseCommitted(false),
+		PoseInputCycles(0),
+		PoseStart(FVector::ZeroVector),
+		PoseTarget(FVector::ZeroVector),
+		bGraspProbeOpen(false),
+		bGraspCommitted(false),
+		GraspInputCycles(0),
+		LastGraspAxis(0.0f)
+	{}
+
+	// A pose target has been seen, the next change opens a probe
+	bool bPoseTargetValid;
+
+	// Waiting for the hand to reach the pose target
+	bool bPoseProbeOpen;
+
+	// The pose target has been written to physics
+	bool bPoseCommitted;
+
+	// Time of the pose change (FPlatformTime::Cycles64)
+	uint64 PoseInputCycles;
+
+	// Hand location at the pose change
+	FVector PoseStart;
+
+	// Target location of the pose change
+	FVector PoseTarget;
+
+	// Waiting for the fingers to reach contact
+	bool bGraspProbeOpen;
+
+	// The finger targets have been written to physics
+	bool bGraspCommitted;
+
+	// Time of the trigger press (FPlatformTime::Cycles64)
+	uint64 GraspInputCycles;
+
+	// Grasp axis value of the last input
+	float LastGraspAxis;
+};
+
+/**
+ * Latency histograms of the current session, shared by all hands:
+ * from a motion controller pose change to the physics step moving the hand and to the hand reaching the pose,
+ * from a grasp trigger press to the physics step driving the fingers and to the fingers reaching contact.
+ * Shown with "stat HandLatency" and written to the log at the end of the session.
+ */
+class UFORCEBASEDGRASPING_API HandLatencyStats
+{
+public:
+	// Motion controller pose change to the physics step applying the tracking target
+	static LatencyHistogram PoseToPhysics;
+
+	// Motion controller pose change to the hand reaching the pose
+	static LatencyHistogram PoseToConvergence;
+
+	// Grasp trigger press to the physics step driving the fingers
+	static LatencyHistogram TriggerToPhysics;
+
+	// Grasp trigger press to the fingers reaching contact
+	static LatencyHistogram TriggerToContact;
+
+	// Milliseconds between two timestamps of FPlatformTime::Cycles64
+	static float CyclesToMilliseconds(const uint64 StartCycles, const uint64 EndCycles);
+
+	// Publish the percentiles to the stats
+	static void UpdateStats();
+
+	// Write all histograms to the log
+	static void LogSession();
+
+	// Start a new session
+	static void Reset();
+};
@@ -0,0 +1,214 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "HandManager.h"
+#include "Hand.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Async/ParallelFor.h"
+#include "HandLatencyStats.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hands read physics state"), STAT_HandsReadPhysicsState, STATGROUP_HandLatency);
+DECLARE_CYCLE_STAT(TEXT("Hands compute control"), STAT_HandsComputeControl, STATGROUP_HandLatency);
+DECLARE_CYCLE_STAT(TEXT("Hands batched tracking"), STAT_HandsBatchedTracking, STATGROUP_HandLatency);
+DECLARE_CYCLE_STAT(TEXT("Hands write physics state"), STAT_HandsWritePhysicsState, STATGROUP_HandLatency);
+
+// Sets default values
+AHandManager::AHandManager()
+{
+	// Update the hands before the physics step, the state read is the result of the last step
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickGroup = TG_PrePhysics;
+
+	bParallelCompute = true;
+	MinHandsForParallelCompute = 4;
+	bBatchedTracking = true;
+}
+
+// Get the manager of the world, spawns it if there is none
+AHandManager* AHandManager::Get(UWorld* World)
+{
+	if (!World) return nullptr;
+
+	for (TActorIterator<AHandManager> ManagerItr(World); ManagerItr; ++ManagerItr)
+	{
+		return *ManagerItr;
+	}
+	return World->SpawnActor<AHandManager>();
+}
+
+// Update the hand with the manager, disables the tick of the hand
+void AHandManager::RegisterHand(AHand* InHand)
+{
+	if (!InHand) return;
+
+	if (!Hands.Contains(InHand))
+	{
+		Hands.Add(InHand);
+		if (bBatchedTracking)
+		{
+			// The gains are set on every update
+			const int32 Slot = LocationTrackingController.AddController(0.0f, 0.0f, 0.0f);
+			verify(RotationTrackingController.AddController(0.0f, 0.0f, 0.0f) == Slot);
+			verify(SubstepLocationTrackingController.AddController(0.0f, 0.0f, 0.0f) == Slot);
+			verify(SubstepRotationTrackingController.AddController(0.0f, 0.0f, 0.0f) == Slot);
+			InHand->SetTrackingBatchSlot(Slot);
+		}
+	}
+	InHand->SetActorTickEnabled(false);
+}
+
+// Stop updating the hand
+void AHandManager::UnregisterHand(AHand* InHand)
+{
+	if (!InHand) return;
+
+	if (Hands.Remove(InHand) > 0 && InHand->GetTrackingBatchSlot() != INDEX_NONE)
+	{
+		LocationTrackingController.RemoveController(InHand->GetTrackingBatchSlot());
+		RotationTrackingController.RemoveController(InHand->GetTrackingBatchSlot());
+		SubstepLocationTrackingController.RemoveController(InHand->GetTrackingBatchSlot());
+		SubstepRotationTrackingController.RemoveController(InHand->GetTrackingBatchSlot());
+		InHand->SetTrackingBatchSlot(INDEX_NONE);
+	}
+}
+
+// Called every frame
+void AHandManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ActiveHands.Reset();
+	for (const TWeakObjectPtr<AHand>& Hand : Hands)
+	{
+		if (Hand.IsValid())
+		{
+			ActiveHands.Add(Hand.Get());
+		}
+	}
+	if (ActiveHands.Num() != Hands.Num())
+	{
+		Hands.RemoveAll([](const TWeakObjectPtr<AHand>& Hand) { return !Hand.IsValid(); });
+	}
+
+	// Read the physics state of all hands
+	{
+		SCOPE_CYCLE_COUNTER(STAT_HandsReadPhysicsState);
+		for (AHand* const Hand : ActiveHands)
+		{
+			Hand->ReadPhysicsState();
+		}
+	}
+
+	// Compute the controllers of all hands (hand local data only, no physics access)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_HandsComputeControl);
+		const bool bSingleThread = !bParallelCompute || ActiveHands.Num() < MinHandsForParallelCompute;
+		ParallelFor(ActiveHands.Num(), [this, DeltaTime](int32 HandIndex)
+		{
+			ActiveHands[HandIndex]->ComputeControl(DeltaTime);
+		}, bSingleThread);
+	}
+
+	// Tracking controllers of all hands in one pass
+	if (bBatchedTracking)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_HandsBatchedTracking);
+		AHandManager::UpdateBatchedTracking(DeltaTime);
+	}
+
+	// Apply the controller outputs to physics, serially on the game thread
+	{
+		SCOPE_CYCLE_COUNTER(STAT_HandsWritePhysicsState);
+		for (AHand* const Hand : ActiveHands)
+		{
+			Hand->WritePhysicsState();
+		}
+	}
+
+	// Hands not tracked in the upcoming substeps restart their substep controllers without history
+	for (AHand* const Hand : ActiveHands)
+	{
+		const int32 Slot = Hand->GetTrackingBatchSlot();
+		if (Slot != INDEX_NONE && !Hand->HasSubstepTracking())
+		{
+			SubstepLocationTrackingController.ResetHistory(Slot);
+			SubstepRotationTrackingController.ResetHistory(Slot);
+		}
+	}
+}
+
+// Update the tracking controllers of the hands tracking once per frame
+void AHandManager::UpdateBatchedTracking(const float DeltaTime)
+{
+	// Gather the errors, hands without frame tracking keep zero gains
+	for (AHand* const Hand : ActiveHands)
+	{
+		const int32 Slot = Hand->GetTrackingBatchSlot();
+		if (Slot == INDEX_NONE) continue;
+
+		if (Hand->HasFrameTracking())
+		{
+			AHandManager::SetTrackingControllers(Hand, Slot, Hand->GetTrackingLocationError(), Hand->GetTrackingRotationError(),
+				Hand->GetHandState().RootAngularVelocity, LocationTrackingController, RotationTrackingController);
+		}
+		else
+		{
+			// Without history the D term does not kick when the tracking resumes
+			LocationTrackingController.SetGains(Slot, 0.0f, 0.0f, 0.0f);
+			RotationTrackingController.SetGains(Slot, 0.0f, 0.0f, 0.0f);
+			LocationTrackingController.ResetHistory(Slot);
+			RotationTrackingController.ResetHistory(Slot);
+		}
+	}
+
+	LocationTrackingController.Update(DeltaTime);
+	RotationTrackingController.Update(DeltaTime);
+
+	// Scatter the outputs, applied in the write phase
+	for (AHand* const Hand : ActiveHands)
+	{
+		const int32 Slot = Hand->GetTrackingBatchSlot();
+		if (Slot != INDEX_NONE && Hand->HasFrameTracking())
+		{
+			Hand->SetTrackingOutput(LocationTrackingController.GetOutput(Slot), RotationTrackingController.GetOutput(Slot));
+		}
+	}
+}
+
+// Update the substep tracking controllers of the slot of the hand, called from the substep callback of the hand
+void AHandManager::UpdateTrackingSubstep(AHand* Hand, const float DeltaTime)
+{
+	// Only the slot of the hand is written, the callbacks of the hands run one after the other on the physics thread
+	const int32 Slot = Hand->GetTrackingBatchSlot();
+	FVector LocationError, RotationError, AngularVelocity;
+	if (Slot == INDEX_NONE || !Hand->ComputeSubstepTrackingError(LocationError, RotationError, AngularVelocity)) return;
+
+	AHandManager::SetTrackingControllers(Hand, Slot, LocationError, RotationError,
+		AngularVelocity, SubstepLocationTrackingController, SubstepRotationTrackingController);
+	SubstepLocationTrackingController.UpdateSlot(Slot, DeltaTime);
+	SubstepRotationTrackingController.UpdateSlot(Slot, DeltaTime);
+	Hand->ApplySubstepTrackingOutput(SubstepLocationTrackingController.GetOutput(Slot), SubstepRotationTrackingController.GetOutput(Slot));
+}
+
+// Set the gains and errors of the tracking controllers of the slot
+void AHandManager::SetTrackingControllers(const AHand* Hand, const int32 Slot, const FVector& LocationError, const FVector& RotationError,
+	const FVector& AngularVelocity, BatchedPDController& LocationController, BatchedPDController& RotationController)
+{
+	float PGain, DGain, MaxOutput, RotationBoost;
+	Hand->GetTrackingGains(PGain, DGain, MaxOutput, RotationBoost);
+	LocationController.SetGains(Slot, PGain, DGain, MaxOutput);
+	LocationController.SetError(Slot, LocationError);
+	if (Hand->IsRotationPDControl())
+	{
+		// Angular acceleration with the measured angular velocity as damping
+		float RotationPGain, RotationDGain, MaxAngularAcceleration;
+		Hand->GetRotationPDGains(RotationPGain, RotationDGain, MaxAngularAcceleration);
+		RotationController.SetGains(Slot, RotationPGain, RotationDGain, MaxAngularAcceleration);
+		RotationController.SetError(Slot, RotationError, -AngularVelocity);
+	}
+	else
+	{
+		RotationController.SetGains(Slot, RotationBoost, 0.0f, BIG_NUMBER);
+		RotationController.SetError(Slot, RotationError);
+	}
+}
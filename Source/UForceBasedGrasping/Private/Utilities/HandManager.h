@@ -0,0 +1,83 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "BatchedPDController.h"
+
+#include "HandManager.generated.h"
+
+class AHand;
+
+/**
+ * Updates all registered hands in a single tick before the physics step,
+ * instead of every hand ticking on its own. The update is split into phases over all hands:
+ * read the physics state, compute the controllers, write the controller output to physics.
+ * The tracking controllers of all hands are kept in batched controllers. The once per frame tracking
+ * is updated in one pass over all hands, the substep tracking of each hand from the substep callback of its own body.
+ */
+UCLASS()
+class UFORCEBASEDGRASPING_API AHandManager : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	AHandManager();
+
+	// Called every frame
+	virtual void Tick(float DeltaTime) override;
+
+	// Get the manager of the world, spawns it if there is none
+	static AHandManager* Get(UWorld* World);
+
+	// Update the hand with the manager, disables the tick of the hand
+	void RegisterHand(AHand* InHand);
+
+	// Stop updating the hand
+	void UnregisterHand(AHand* InHand);
+
+	// Number of registered hands
+	int32 GetNumHands() const { return Hands.Num(); };
+
+	// Update the substep tracking controllers of the slot of the hand, called from the substep callback of the hand (physics substep)
+	void UpdateTrackingSubstep(AHand* Hand, const float DeltaTime);
+
+protected:
+	// Compute the controllers of the hands in parallel
+	UPROPERTY(EditAnywhere, Category = "Hand Manager")
+		bool bParallelCompute;
+
+	// Minimum number of hands to compute in parallel, fewer hands are not worth the task overhead
+	UPROPERTY(EditAnywhere, Category = "Hand Manager", meta = (editcondition = "bParallelCompute"), meta = (ClampMin = 1))
+		int32 MinHandsForParallelCompute;
+
+	// Update the tracking controllers of all hands in the batched controllers (per frame and per substep)
+	UPROPERTY(EditAnywhere, Category = "Hand Manager")
+		bool bBatchedTracking;
+
+private:
+	// Registered hands
+	TArray<TWeakObjectPtr<AHand>> Hands;
+
+	// Hands updated in the current tick
+	TArray<AHand*> ActiveHands;
+
+	// Location tracking controllers of the hands, indexed by the batch slot of the hand
+	BatchedPDController LocationTrackingController;
+
+	// Rotation tracking controllers of the hands, same slots, the rotation boost is the proportional gain
+	BatchedPDController RotationTrackingController;
+
+	// Substep tracking controllers of the hands, same slots
+	BatchedPDController SubstepLocationTrackingController;
+	BatchedPDController SubstepRotationTrackingController;
+
+	// Update the tracking controllers of the hands tracking once per frame
+	void UpdateBatchedTracking(const float DeltaTime);
+
+	// Set the gains and errors of the tracking controllers of the slot
+	static void SetTrackingControllers(const AHand* Hand, const int32 Slot, const FVector& LocationError, const FVector& RotationError,
+		const FVector& AngularVelocity, BatchedPDController& LocationController, BatchedPDController& RotationController);
+};
@@ -0,0 +1,139 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "HandPoseTableCache.h"
+#include "HandInformationParser.h"
+#include "Paths.h"
+
+TMap<int32, TSharedPtr<const FHandPoseTable>> HandPoseTableCache::PoseTables;
+
+namespace
+{
+	// Key of a table in the cache
+	FORCEINLINE int32 GetPoseTableKey(const EGraspType GraspType, const EAxis::Type MirrorAxis)
+	{
+		return static_cast<int32>(GraspType) * 4 + static_cast<int32>(MirrorAxis);
+	}
+
+	// Mirror the joint rotations of a finger
+	void MirrorFingerOrientation(FFingerOrientation& FingerOrientation, const EAxis::Type MirrorAxis)
+	{
+		FFingerOrientation& F = FingerOrientation;
+		F.MetacarpalOrientation.Orientation = HandPoseTableCache::MirrorRotator(F.MetacarpalOrientation.Orientation, MirrorAxis);
+		F.ProximalOrientation.Orientation = HandPoseTableCache::MirrorRotator(F.ProximalOrientation.Orientation, MirrorAxis);
+		F.IntermediateOrientation.Orientation = HandPoseTableCache::MirrorRotator(F.IntermediateOrientation.Orientation, MirrorAxis);
+		F.DistalOrientation.Orientation = HandPoseTableCache::MirrorRotator(F.DistalOrientation.Orientation, MirrorAxis);
+	}
+
+	// Mirror the joint rotations of a hand
+	void MirrorHandOrientation(FHandOrientation& HandOrientation, const EAxis::Type MirrorAxis)
+	{
+		MirrorFingerOrientation(HandOrientation.ThumbOrientation, MirrorAxis);
+		MirrorFingerOrientation(HandOrientation.IndexOrientation, MirrorAxis);
+		MirrorFingerOrientation(HandOrientation.MiddleOrientation, MirrorAxis);
+		MirrorFingerOrientation(HandOrientation.RingOrientation, MirrorAxis);
+		MirrorFingerOrientation(HandOrientation.PinkyOrientation, MirrorAxis);
+	}
+
+	// Mirror the joint velocities of a finger
+	void MirrorFingerVelocity(FFingerVelocity& FingerVelocity, const EAxis::Type MirrorAxis)
+	{
+		FFingerVelocity& F = FingerVelocity;
+		F.MetacarpalVelocity.Velocity = HandPoseTableCache::MirrorAngularVelocity(F.MetacarpalVelocity.Velocity, MirrorAxis);
+		F.ProximalVelocity.Velocity = HandPoseTableCache::MirrorAngularVelocity(F.ProximalVelocity.Velocity, MirrorAxis);
+		F.IntermediateVelocity.Velocity = HandPoseTableCache::MirrorAngularVelocity(F.IntermediateVelocity.Velocity, MirrorAxis);
+		F.DistalVelocity.Velocity = HandPoseTableCache::MirrorAngularVelocity(F.DistalVelocity.Velocity, MirrorAxis);
+	}
+}
+
+// Get the shared pose table of the grasp type, mirrored along the axis
+TSharedPtr<const FHandPoseTable> HandPoseTableCache::Get(const EGraspType GraspType, const EAxis::Type MirrorAxis)
+{
+	check(IsInGameThread());
+
+	const int32 Key = GetPoseTableKey(GraspType, MirrorAxis);
+	if (const TSharedPtr<const FHandPoseTable>* PoseTable = PoseTables.Find(Key))
+	{
+		return *PoseTable;
+	}
+
+	// The mirrored tables are derived from the table of the ini file, which is parsed only once
+	TSharedPtr<const FHandPoseTable> NewPoseTable;
+	if (MirrorAxis == EAxis::None)
+	{
+		NewPoseTable = Load(GraspType);
+	}
+	else
+	{
+		const TSharedPtr<const FHandPoseTable> SourcePoseTable = Get(GraspType, EAxis::None);
+		if (SourcePoseTable.IsValid())
+		{
+			NewPoseTable = Mirror(*SourcePoseTable, MirrorAxis);
+		}
+	}
+	if (NewPoseTable.IsValid())
+	{
+		PoseTables.Add(Key, NewPoseTable);
+	}
+	return NewPoseTable;
+}
+
+// Drop all tables
+void HandPoseTableCache::Invalidate()
+{
+	PoseTables.Empty();
+}
+
+// Mirror a joint rotation along the axis, the rotation axis component along the mirror axis is kept, the others are negated
+FRotator HandPoseTableCache::MirrorRotator(const FRotator& Rotator, const EAxis::Type MirrorAxis)
+{
+	if (MirrorAxis == EAxis::None) return Rotator;
+
+	FQuat Quat = Rotator.Quaternion();
+	Quat.X = MirrorAxis == EAxis::X ? Quat.X : -Quat.X;
+	Quat.Y = MirrorAxis == EAxis::Y ? Quat.Y : -Quat.Y;
+	Quat.Z = MirrorAxis == EAxis::Z ? Quat.Z : -Quat.Z;
+	return Quat.Rotator();
+}
+
+// Mirror an angular velocity along the axis (same rule as the rotation axis)
+FVector HandPoseTableCache::MirrorAngularVelocity(const FVector& Velocity, const EAxis::Type MirrorAxis)
+{
+	if (MirrorAxis == EAxis::None) return Velocity;
+
+	return FVector(
+		MirrorAxis == EAxis::X ? Velocity.X : -Velocity.X,
+		MirrorAxis == EAxis::Y ? Velocity.Y : -Velocity.Y,
+		MirrorAxis == EAxis::Z ? Velocity.Z : -Velocity.Z);
+}
+
+// Parse the table of the grasp type out of its ini file
+TSharedPtr<const FHandPoseTable> HandPoseTableCache::Load(const EGraspType GraspType)
+{
+	const UEnum* EnumPtr = FindObject<UEnum>(ANY_PACKAGE, TEXT("EGraspType"), true);
+	if (!EnumPtr) return nullptr;
+
+	const FString ConfigDir = FPaths::ProjectPluginsDir().Append("UForceBasedGrasping/Config/");
+	const FString GraspTypeString = EnumPtr->GetDisplayNameTextByIndex(static_cast<int64>(GraspType)).ToString();
+	const FString ConfigName = ConfigDir + GraspTypeString + ".ini";
+
+	TSharedPtr<FHandPoseTable> PoseTable = MakeShareable(new FHandPoseTable());
+	HandInformationParser Parser;
+	Parser.GetHandInformationForGraspType(PoseTable->InitialHandOrientation, PoseTable->ClosedHandOrientation, PoseTable->HandVelocity, ConfigName);
+	return PoseTable;
+}
+
+// Mirror all finger targets of the table
+TSharedPtr<const FHandPoseTable> HandPoseTableCache::Mirror(const FHandPoseTable& PoseTable, const EAxis::Type MirrorAxis)
+{
+	TSharedPtr<FHandPoseTable> MirroredPoseTable = MakeShareable(new FHandPoseTable(PoseTable));
+	MirrorHandOrientation(MirroredPoseTable->InitialHandOrientation, MirrorAxis);
+	MirrorHandOrientation(MirroredPoseTable->ClosedHandOrientation, MirrorAxis);
+
+	FHandVelocity& HandVelocity = MirroredPoseTable->HandVelocity;
+	MirrorFingerVelocity(HandVelocity.ThumbVelocity, MirrorAxis);
+	MirrorFingerVelocity(HandVelocity.IndexVelocity, MirrorAxis);
+	MirrorFingerVelocity(HandVelocity.MiddleVelocity, MirrorAxis);
+	MirrorFingerVelocity(HandVelocity.RingVelocity, MirrorAxis);
+	MirrorFingerVelocity(HandVelocity.PinkyVelocity, MirrorAxis);
+	return MirroredPoseTable;
+}
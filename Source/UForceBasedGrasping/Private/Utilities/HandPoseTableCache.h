@@ -0,0 +1,52 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enums/GraspType.h"
+#include "Structs/HandOrientation.h"
+#include "Structs/HandVelocity.h"
+
+// Finger targets of a grasp type
+struct FHandPoseTable
+{
+	// The initial HandOrientation
+	FHandOrientation InitialHandOrientation;
+
+	// The closed HandOrientation
+	FHandOrientation ClosedHandOrientation;
+
+	// The HandVelocity after grasping
+	FHandVelocity HandVelocity;
+};
+
+/**
+ * Loads the pose tables of the grasp types once and shares them between all hands.
+ * The ini files describe the right hand, the tables of the other handedness
+ * are derived by mirroring the joint rotations and velocities at load time.
+ */
+class UFORCEBASEDGRASPING_API HandPoseTableCache
+{
+public:
+	// Get the shared pose table of the grasp type, mirrored along the axis (EAxis::None = as in the ini file)
+	static TSharedPtr<const FHandPoseTable> Get(const EGraspType GraspType, const EAxis::Type MirrorAxis = EAxis::None);
+
+	// Drop all tables, e.g. after the ini files have been rewritten
+	static void Invalidate();
+
+	// Mirror a joint rotation along the axis
+	static FRotator MirrorRotator(const FRotator& Rotator, const EAxis::Type MirrorAxis);
+
+	// Mirror an angular velocity along the axis
+	static FVector MirrorAngularVelocity(const FVector& Velocity, const EAxis::Type MirrorAxis);
+
+private:
+	// Parse the table of the grasp type out of its ini file
+	static TSharedPtr<const FHandPoseTable> Load(const EGraspType GraspType);
+
+	// Mirror all finger targets of the table
+	static TSharedPtr<const FHandPoseTable> Mirror(const FHandPoseTable& PoseTable, const EAxis::Type MirrorAxis);
+
+	// Tables by grasp type and mirror axis
+	static TMap<int32, TSharedPtr<const FHandPoseTable>> PoseTables;
+};
@@ -0,0 +1,192 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "HandProximityService.h"
+#include "Hand.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "WorldCollision.h"
+
+// Sets default values
+AHandProximityService::AHandProximityService()
+{
+	// Query after the physics step
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickGroup = TG_PostPhysics;
+
+	QueryRate = 0.f;
+	MaxBatchRadius = 150.f;
+	TimeSinceLastQuery = 0.f;
+}
+
+// Get the service of the world, spawns it if there is none
+AHandProximityService* AHandProximityService::Get(UWorld* World)
+{
+	if (!World) return nullptr;
+
+	for (TActorIterator<AHandProximityService> ServiceItr(World); ServiceItr; ++ServiceItr)
+	{
+		return *ServiceItr;
+	}
+	return World->SpawnActor<AHandProximityService>();
+}
+
+// Add a hand to the queries
+void AHandProximityService::RegisterHand(AHand* InHand)
+{
+	if (!InHand) return;
+
+	for (const FHandProximityEntry& Entry : Entries)
+	{
+		if (Entry.Hand == InHand) return;
+	}
+	FHandProximityEntry NewEntry;
+	NewEntry.Hand = InHand;
+	Entries.Add(NewEntry);
+}
+
+// Remove a hand from the queries
+void AHandProximityService::UnregisterHand(AHand* InHand)
+{
+	Entries.RemoveAll([InHand](const FHandProximityEntry& Entry) { return Entry.Hand == InHand; });
+}
+
+// Report all objects as out of reach and forget them
+void AHandProximityService::ResetHand(AHand* InHand)
+{
+	for (FHandProximityEntry& Entry : Entries)
+	{
+		if (Entry.Hand == InHand)
+		{
+			PushDiff(Entry, TSet<TWeakObjectPtr<AActor>>());
+		}
+	}
+}
+
+// Called every frame
+void AHandProximityService::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceLastQuery += DeltaTime;
+	if (QueryRate <= 0.f || TimeSinceLastQuery >= 1.f / QueryRate)
+	{
+		TimeSinceLastQuery = 0.f;
+		UpdateProximity();
+	}
+}
+
+// Query the objects in reach of all hands
+void AHandProximityService::UpdateProximity()
+{
+	Entries.RemoveAll([](const FHandProximityEntry& Entry) { return !Entry.Hand.IsValid(); });
+
+	// Reach spheres of the hands that currently look for objects
+	TArray<int32, TInlineAllocator<8>> ActiveEntries;
+	TArray<FSphere, TInlineAllocator<8>> ReachSpheres;
+	FCollisionQueryParams QueryParams(FName(TEXT("HandProximity")), false);
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		AHand* const Hand = Entries[EntryIndex].Hand.Get();
+		QueryParams.AddIgnoredActor(Hand);
+
+		FSphere ReachSphere;
+		if (Hand->GetFixationGraspReach(ReachSphere))
+		{
+			ActiveEntries.Add(EntryIndex);
+			ReachSpheres.Add(ReachSphere);
+		}
+	}
+	if (ActiveEntries.Num() == 0) return;
+
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	ObjectParams.AddObjectTypesToQuery(ECC_PhysicsBody);
+
+	// Group the hands whose reach spheres fit into one query sphere, usually all hands of a player are one group
+	TArray<FSphere, TInlineAllocator<8>> GroupSpheres;
+	TArray<int32, TInlineAllocator<8>> GroupSizes;
+	TArray<int32, TInlineAllocator<8>> SphereGroups;
+	for (const FSphere& ReachSphere : ReachSpheres)
+	{
+		int32 Group = INDEX_NONE;
+		for (int32 GroupIndex = 0; GroupIndex < GroupSpheres.Num() && Group == INDEX_NONE; ++GroupIndex)
+		{
+			const FSphere MergedSphere = GroupSpheres[GroupIndex] + ReachSphere;
+			if (MergedSphere.W <= MaxBatchRadius)
+			{
+				GroupSpheres[GroupIndex] = MergedSphere;
+				++GroupSizes[GroupIndex];
+				Group = GroupIndex;
+			}
+		}
+		if (Group == INDEX_NONE)
+		{
+			Group = GroupSpheres.Add(ReachSphere);
+			GroupSizes.Add(1);
+		}
+		SphereGroups.Add(Group);
+	}
+
+	// One query per group
+	TArray<FOverlapResult> Overlaps;
+	for (int32 GroupIndex = 0; GroupIndex < GroupSpheres.Num(); ++GroupIndex)
+	{
+		const FSphere& GroupSphere = GroupSpheres[GroupIndex];
+		Overlaps.Reset();
+		GetWorld()->OverlapMultiByObjectType(Overlaps, GroupSphere.Center, FQuat::Identity,
+			ObjectParams, FCollisionShape::MakeSphere(GroupSphere.W), QueryParams);
+		const bool bBatched = GroupSizes[GroupIndex] > 1;
+
+		for (int32 ActiveIndex = 0; ActiveIndex < ActiveEntries.Num(); ++ActiveIndex)
+		{
+			if (SphereGroups[ActiveIndex] != GroupIndex) continue;
+
+			const FSphere& ReachSphere = ReachSpheres[ActiveIndex];
+			TSet<TWeakObjectPtr<AActor>> CurrentActors;
+			for (const FOverlapResult& Overlap : Overlaps)
+			{
+				UPrimitiveComponent* const Component = Overlap.GetComponent();
+				AActor* const Actor = Overlap.GetActor();
+				if (!Component || !Actor) continue;
+
+				// Distribute the batched results to the hands by the bounds of the overlapped components
+				if (bBatched && Component->Bounds.GetBox().ComputeSquaredDistanceToPoint(ReachSphere.Center) > FMath::Square(ReachSphere.W))
+					continue;
+
+				CurrentActors.Add(Actor);
+			}
+			PushDiff(Entries[ActiveEntries[ActiveIndex]], CurrentActors);
+		}
+	}
+}
+
+// Report the difference between the last and the current objects in reach to the hand
+void AHandProximityService::PushDiff(FHandProximityEntry& Entry, const TSet<TWeakObjectPtr<AActor>>& CurrentActors)
+{
+	AHand* const Hand = Entry.Hand.Get();
+	if (!Hand) return;
+
+	// Objects out of reach (including the destroyed ones, as long as they are not garbage collected)
+	for (auto ActorItr = Entry.ActorsInReach.CreateIterator(); ActorItr; ++ActorItr)
+	{
+		AActor* const Actor = ActorItr->Get(true);
+		if (!Actor || Actor->IsPendingKill() || !CurrentActors.Contains(*ActorItr))
+		{
+			if (Actor)
+			{
+				Hand->OnObjectLeftReach(Actor);
+			}
+			ActorItr.RemoveCurrent();
+		}
+	}
+
+	// Objects coming in reach
+	for (const TWeakObjectPtr<AActor>& Actor : CurrentActors)
+	{
+		if (!Entry.ActorsInReach.Contains(Actor))
+		{
+			Entry.ActorsInReach.Add(Actor);
+			Hand->OnObjectInReach(Actor.Get());
+		}
+	}
+}
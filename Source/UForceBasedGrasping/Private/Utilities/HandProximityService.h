@@ -0,0 +1,73 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#include "HandProximityService.generated.h"
+
+class AHand;
+
+// Objects in reach of a registered hand
+struct FHandProximityEntry
+{
+	// The registered hand
+	TWeakObjectPtr<AHand> Hand;
+
+	// Objects reported to the hand as in reach
+	TSet<TWeakObjectPtr<AActor>> ActorsInReach;
+};
+
+/**
+ * Finds the objects in reach of all hands with batched sphere queries once per physics step
+ * (one query per group of nearby hands),
+ * and reports the objects entering and leaving the reach of each hand.
+ * Replaces the overlap events of the fixation grasp areas.
+ */
+UCLASS()
+class UFORCEBASEDGRASPING_API AHandProximityService : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	AHandProximityService();
+
+	// Called every frame
+	virtual void Tick(float DeltaTime) override;
+
+	// Get the service of the world, spawns it if there is none
+	static AHandProximityService* Get(UWorld* World);
+
+	// Add a hand to the queries
+	void RegisterHand(AHand* InHand);
+
+	// Remove a hand from the queries
+	void UnregisterHand(AHand* InHand);
+
+	// Report all objects as out of reach and forget them, e.g. while the hand is grasping
+	void ResetHand(AHand* InHand);
+
+protected:
+	// Number of queries per second (0 = once per physics step, after it)
+	UPROPERTY(EditAnywhere, Category = "Proximity", meta = (ClampMin = 0))
+		float QueryRate;
+
+	// Maximum radius (cm) of the sphere query of a group of hands, hands further apart are queried in separate groups
+	UPROPERTY(EditAnywhere, Category = "Proximity", meta = (ClampMin = 0))
+		float MaxBatchRadius;
+
+private:
+	// Registered hands
+	TArray<FHandProximityEntry> Entries;
+
+	// Time since the last query
+	float TimeSinceLastQuery;
+
+	// Query the objects in reach of all hands
+	void UpdateProximity();
+
+	// Report the difference between the last and the current objects in reach to the hand
+	void PushDiff(FHandProximityEntry& Entry, const TSet<TWeakObjectPtr<AActor>>& CurrentActors);
+};
@@ -0,0 +1,141 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "MCInputRecording.h"
+#include "FileHelper.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+	// Identifies the file format
+	const uint32 RecordingMagic = 0x5243434D; // "MCCR"
+
+	// Increase when the frame layout changes
+	const int32 RecordingVersion = 1;
+}
+
+// Constructor
+MCInputRecording::MCInputRecording() :
+	StartTime(0.0f),
+	ReplayTime(0.0f),
+	ReplayFrameIndex(0)
+{
+}
+
+// Forget all frames
+void MCInputRecording::Reset()
+{
+	Frames.Empty();
+	StartTime = 0.0f;
+	MCInputRecording::StartReplay();
+}
+
+// Append a frame, its time is relative to the first frame
+void MCInputRecording::AddFrame(const FMCInputFrame& Frame, const float WorldTime)
+{
+	if (Frames.Num() == 0)
+	{
+		StartTime = WorldTime;
+	}
+	const int32 Index = Frames.Add(Frame);
+	Frames[Index].Time = WorldTime - StartTime;
+}
+
+// Write the frames to the file
+bool MCInputRecording::SaveToFile(const FString& Filename)
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+
+	uint32 Magic = RecordingMagic;
+	int32 Version = RecordingVersion;
+	Writer << Magic << Version;
+	Writer << Frames;
+
+	if (!FFileHelper::SaveArrayToFile(Data, *Filename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Input recording could not be written to %s"), *Filename);
+		return false;
+	}
+	UE_LOG(LogTemp, Log, TEXT("Input recording with %d frames (%.1f s) written to %s"), Frames.Num(), GetDuration(), *Filename);
+	return true;
+}
+
+// Read the frames from the file
+bool MCInputRecording::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Filename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Input recording %s could not be read"), *Filename);
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != RecordingMagic || Version != RecordingVersion)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s is not an input recording of version %d"), *Filename, RecordingVersion);
+		return false;
+	}
+
+	TArray<FMCInputFrame> LoadedFrames;
+	Reader << LoadedFrames;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Input recording %s is corrupted"), *Filename);
+		return false;
+	}
+
+	Frames = MoveTemp(LoadedFrames);
+	MCInputRecording::StartReplay();
+	return true;
+}
+
+// Start the replay at the first frame
+void MCInputRecording::StartReplay()
+{
+	ReplayTime = 0.0f;
+	ReplayFrameIndex = 0;
+}
+
+// Advance the replay by the timestep
+bool MCInputRecording::Replay(const float DeltaTime, FMCInputFrame& OutFrame)
+{
+	if (MCInputRecording::IsReplayFinished())
+	{
+		return false;
+	}
+
+	// The first frame is played at the start, the timestep only counts from there on
+	if (ReplayFrameIndex > 0)
+	{
+		ReplayTime += DeltaTime;
+	}
+
+	// Collect the actions of all frames passed in this step
+	OutFrame.Actions.Reset();
+	while (ReplayFrameIndex < Frames.Num() && Frames[ReplayFrameIndex].Time <= ReplayTime)
+	{
+		OutFrame.Actions.Append(Frames[ReplayFrameIndex].Actions);
+		++ReplayFrameIndex;
+	}
+
+	// Poses and axes between the last passed frame and the next one
+	const FMCInputFrame& Prev = Frames[FMath::Max(ReplayFrameIndex - 1, 0)];
+	const FMCInputFrame& Next = Frames[FMath::Min(ReplayFrameIndex, Frames.Num() - 1)];
+	const float Span = Next.Time - Prev.Time;
+	const float Alpha = Span > KINDA_SMALL_NUMBER ? FMath::Clamp((ReplayTime - Prev.Time) / Span, 0.0f, 1.0f) : 1.0f;
+
+	OutFrame.Time = ReplayTime;
+	OutFrame.LeftLocation = FMath::Lerp(Prev.LeftLocation, Next.LeftLocation, Alpha);
+	OutFrame.LeftRotation = FQuat::Slerp(Prev.LeftRotation, Next.LeftRotation, Alpha);
+	OutFrame.RightLocation = FMath::Lerp(Prev.RightLocation, Next.RightLocation, Alpha);
+	OutFrame.RightRotation = FQuat::Slerp(Prev.RightRotation, Next.RightRotation, Alpha);
+	// Axis values are held like the input system does between frames
+	OutFrame.LeftGraspAxis = Prev.LeftGraspAxis;
+	OutFrame.RightGraspAxis = Prev.RightGraspAxis;
+	return true;
+}
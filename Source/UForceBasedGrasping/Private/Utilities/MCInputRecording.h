@@ -0,0 +1,120 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enums/MCInputAction.h"
+
+// An input action with its argument (e.g. the grasp type)
+struct FMCInputActionEvent
+{
+	FMCInputActionEvent() : Action(EMCInputAction::SwitchGraspType), Argument(0) {}
+
+	FMCInputActionEvent(const EMCInputAction InAction, const uint8 InArgument = 0) : Action(InAction), Argument(InArgument) {}
+
+	EMCInputAction Action;
+	uint8 Argument;
+
+	friend FArchive& operator<<(FArchive& Ar, FMCInputActionEvent& Event)
+	{
+		uint8 ActionValue = static_cast<uint8>(Event.Action);
+		Ar << ActionValue << Event.Argument;
+		Event.Action = static_cast<EMCInputAction>(ActionValue);
+		return Ar;
+	}
+};
+
+// The input of the motion controller character in one frame
+struct FMCInputFrame
+{
+	FMCInputFrame() :
+		Time(0.0f),
+		LeftLocation(FVector::ZeroVector),
+		LeftRotation(FQuat::Identity),
+		RightLocation(FVector::ZeroVector),
+		RightRotation(FQuat::Identity),
+		LeftGraspAxis(0.0f),
+		RightGraspAxis(0.0f)
+	{}
+
+	// Time since the start of the recording
+	float Time;
+
+	// World pose of the left motion controller
+	FVector LeftLocation;
+	FQuat LeftRotation;
+
+	// World pose of the right motion controller
+	FVector RightLocation;
+	FQuat RightRotation;
+
+	// Grasp axis values
+	float LeftGraspAxis;
+	float RightGraspAxis;
+
+	// Actions triggered since the previous frame
+	TArray<FMCInputActionEvent> Actions;
+
+	friend FArchive& operator<<(FArchive& Ar, FMCInputFrame& Frame)
+	{
+		Ar << Frame.Time;
+		Ar << Frame.LeftLocation << Frame.LeftRotation;
+		Ar << Frame.RightLocation << Frame.RightRotation;
+		Ar << Frame.LeftGraspAxis << Frame.RightGraspAxis;
+		return Ar << Frame.Actions;
+	}
+};
+
+/**
+ * Records the motion controller poses, the grasp axes and the input actions of a session into a binary file,
+ * and plays them back with a fixed timestep, frames in between the recorded ones are interpolated.
+ */
+class UFORCEBASEDGRASPING_API MCInputRecording
+{
+public:
+	// Constructor
+	MCInputRecording();
+
+	// Forget all frames
+	void Reset();
+
+	// Append a frame, its time is relative to the first frame
+	void AddFrame(const FMCInputFrame& Frame, const float WorldTime);
+
+	// Number of recorded frames
+	int32 GetNumFrames() const { return Frames.Num(); };
+
+	// Recorded frame at the index
+	const FMCInputFrame& GetFrame(const int32 Index) const { return Frames[Index]; };
+
+	// Duration of the recording (s)
+	float GetDuration() const { return Frames.Num() > 0 ? Frames.Last().Time : 0.0f; };
+
+	// Write the frames to the file
+	bool SaveToFile(const FString& Filename);
+
+	// Read the frames from the file
+	bool LoadFromFile(const FString& Filename);
+
+	// Start the replay at the first frame
+	void StartReplay();
+
+	// Advance the replay by the timestep, returns the interpolated input and the actions passed in the step
+	bool Replay(const float DeltaTime, FMCInputFrame& OutFrame);
+
+	// The replay passed the last frame
+	bool IsReplayFinished() const { return ReplayFrameIndex >= Frames.Num(); };
+
+private:
+	// Recorded frames
+	TArray<FMCInputFrame> Frames;
+
+	// World time of the first recorded frame
+	float StartTime;
+
+	// Current replay time
+	float ReplayTime;
+
+	// Index of the first frame not yet reached by the replay
+	int32 ReplayFrameIndex;
+};
@@ -0,0 +1,77 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformAtomics.h"
+
+/**
+ * Single producer / single consumer mailbox holding only the latest posted value.
+ * Lock-free triple buffer: the producer never waits for the consumer and
+ * the consumer always reads the most recent complete value.
+ */
+template<typename T>
+class TMailbox
+{
+public:
+	// Constructor
+	TMailbox() :
+		WriteIndex(0),
+		ReadIndex(1),
+		SharedState(2),
+		bHasValue(false)
+	{}
+
+	// Post a new value, overwrites any value not yet fetched (producer side)
+	void Post(const T& Value)
+	{
+		Buffers[WriteIndex] = Value;
+		// Publish the written buffer, take over the previously shared one for the next write
+		const int32 PrevState = FPlatformAtomics::InterlockedExchange(&SharedState, WriteIndex | DirtyFlag);
+		WriteIndex = PrevState & IndexMask;
+	}
+
+	// Get the latest value, returns true if a new value has been posted since the last fetch (consumer side)
+	bool Fetch(T& OutValue)
+	{
+		bool bNewValue = false;
+		// Only the consumer clears the dirty flag, so it can not be lost between the read and the exchange
+		if (FPlatformAtomics::InterlockedAdd(&SharedState, 0) & DirtyFlag)
+		{
+			const int32 PrevState = FPlatformAtomics::InterlockedExchange(&SharedState, ReadIndex);
+			ReadIndex = PrevState & IndexMask;
+			bHasValue = true;
+			bNewValue = true;
+		}
+		if (bHasValue)
+		{
+			OutValue = Buffers[ReadIndex];
+		}
+		return bNewValue;
+	}
+
+	// Check if any value has ever been received by the consumer
+	bool HasValue() const { return bHasValue; }
+
+private:
+	// Flag marking the shared buffer as not yet fetched
+	static const int32 DirtyFlag = 4;
+
+	// Mask to get the buffer index out of the shared state
+	static const int32 IndexMask = 3;
+
+	// The three buffers (write, shared, read)
+	T Buffers[3];
+
+	// Buffer index owned by the producer
+	int32 WriteIndex;
+
+	// Buffer index owned by the consumer
+	int32 ReadIndex;
+
+	// Index of the shared buffer and the dirty flag
+	volatile int32 SharedState;
+
+	// Consumer has received at least one value
+	bool bHasValue;
+};
@@ -0,0 +1,139 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "PhysicsAssetIndexCache.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/PhysicsConstraintTemplate.h"
+#include "PhysicsEngine/BodySetup.h"
+
+TMap<TWeakObjectPtr<const UPhysicsAsset>, TSharedPtr<const PhysicsAssetIndexCache>> PhysicsAssetIndexCache::Caches;
+
+PhysicsAssetIndexCache::PhysicsAssetIndexCache(const UPhysicsAsset* InPhysicsAsset) :
+	LayoutHash(0)
+{
+	if (!InPhysicsAsset) return;
+
+	LayoutHash = ComputeLayoutHash(InPhysicsAsset);
+
+	const int32 NumConstraints = InPhysicsAsset->ConstraintSetup.Num();
+	ConstraintIndexByJointName.Reserve(NumConstraints);
+	for (int32 ConstraintIndex = 0; ConstraintIndex < NumConstraints; ++ConstraintIndex)
+	{
+		const UPhysicsConstraintTemplate* const ConstraintSetup = InPhysicsAsset->ConstraintSetup[ConstraintIndex];
+		if (ConstraintSetup)
+		{
+			ConstraintIndexByJointName.Add(ConstraintSetup->DefaultInstance.JointName, ConstraintIndex);
+		}
+	}
+
+	const int32 NumBodies = InPhysicsAsset->SkeletalBodySetups.Num();
+	BodyIndexByBoneName.Reserve(NumBodies);
+	for (int32 BodyIndex = 0; BodyIndex < NumBodies; ++BodyIndex)
+	{
+		const USkeletalBodySetup* const BodySetup = InPhysicsAsset->SkeletalBodySetups[BodyIndex];
+		if (BodySetup)
+		{
+			BodyIndexByBoneName.Add(BodySetup->BoneName, BodyIndex);
+		}
+	}
+}
+
+PhysicsAssetIndexCache::~PhysicsAssetIndexCache()
+{
+}
+
+TSharedPtr<const PhysicsAssetIndexCache> PhysicsAssetIndexCache::Get(const UPhysicsAsset* PhysicsAsset)
+{
+	check(IsInGameThread());
+
+	if (!PhysicsAsset) return nullptr;
+
+	TSharedPtr<const PhysicsAssetIndexCache>& Cache = Caches.FindOrAdd(PhysicsAsset);
+	if (!Cache.IsValid() || !Cache->IsUpToDate(PhysicsAsset))
+	{
+		// Drop the caches of unloaded assets before adding a new one
+		for (auto CacheItr = Caches.CreateIterator(); CacheItr; ++CacheItr)
+		{
+			if (!CacheItr.Key().IsValid())
+			{
+				CacheItr.RemoveCurrent();
+			}
+		}
+		TSharedPtr<const PhysicsAssetIndexCache> NewCache = MakeShareable(new PhysicsAssetIndexCache(PhysicsAsset));
+		Caches.Add(PhysicsAsset, NewCache);
+		return NewCache;
+	}
+	return Cache;
+}
+
+FName PhysicsAssetIndexCache::ResolveJointName(const FString& BoneName, bool& bOutOtherSide) const
+{
+	bOutOtherSide = false;
+	const FName JointName(*BoneName, FNAME_Find);
+	if (ConstraintIndexByJointName.Contains(JointName))
+	{
+		return JointName;
+	}
+
+	const FString OtherSideName = GetOtherSideBoneName(BoneName);
+	const FName OtherSideJointName = OtherSideName.IsEmpty() ? NAME_None : FName(*OtherSideName, FNAME_Find);
+	if (OtherSideJointName != NAME_None && ConstraintIndexByJointName.Contains(OtherSideJointName))
+	{
+		bOutOtherSide = true;
+		return OtherSideJointName;
+	}
+	return NAME_None;
+}
+
+FName PhysicsAssetIndexCache::ResolveBoneName(const FString& BoneName, bool& bOutOtherSide) const
+{
+	bOutOtherSide = false;
+	const FName Name(*BoneName, FNAME_Find);
+	if (BodyIndexByBoneName.Contains(Name))
+	{
+		return Name;
+	}
+
+	const FString OtherSideName = GetOtherSideBoneName(BoneName);
+	const FName OtherSideBoneName = OtherSideName.IsEmpty() ? NAME_None : FName(*OtherSideName, FNAME_Find);
+	if (OtherSideBoneName != NAME_None && BodyIndexByBoneName.Contains(OtherSideBoneName))
+	{
+		bOutOtherSide = true;
+		return OtherSideBoneName;
+	}
+	return NAME_None;
+}
+
+FString PhysicsAssetIndexCache::GetOtherSideBoneName(const FString& BoneName)
+{
+	if (BoneName.EndsWith(TEXT("_l"), ESearchCase::IgnoreCase))
+	{
+		return BoneName.LeftChop(2) + TEXT("_r");
+	}
+	if (BoneName.EndsWith(TEXT("_r"), ESearchCase::IgnoreCase))
+	{
+		return BoneName.LeftChop(2) + TEXT("_l");
+	}
+	return FString();
+}
+
+bool PhysicsAssetIndexCache::IsUpToDate(const UPhysicsAsset* InPhysicsAsset) const
+{
+	return InPhysicsAsset && ComputeLayoutHash(InPhysicsAsset) == LayoutHash;
+}
+
+uint32 PhysicsAssetIndexCache::ComputeLayoutHash(const UPhysicsAsset* InPhysicsAsset)
+{
+	if (!InPhysicsAsset) return 0;
+
+	// Missing setups hash as NAME_None so they still keep the index order
+	uint32 Hash = HashCombine(GetTypeHash(InPhysicsAsset->ConstraintSetup.Num()), GetTypeHash(InPhysicsAsset->SkeletalBodySetups.Num()));
+	for (const UPhysicsConstraintTemplate* const ConstraintSetup : InPhysicsAsset->ConstraintSetup)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(ConstraintSetup ? ConstraintSetup->DefaultInstance.JointName : NAME_None));
+	}
+	for (const USkeletalBodySetup* const BodySetup : InPhysicsAsset->SkeletalBodySetups)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(BodySetup ? BodySetup->BoneName : NAME_None));
+	}
+	return Hash;
+}
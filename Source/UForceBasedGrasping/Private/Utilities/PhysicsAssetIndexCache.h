@@ -0,0 +1,68 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UPhysicsAsset;
+
+/**
+ * Maps bone names to the constraint and body indices of a physics asset.
+ * The indices match USkeletalMeshComponent::Constraints and ::Bodies of every
+ * component using the asset, so one cache is built and shared per asset.
+ */
+class UFORCEBASEDGRASPING_API PhysicsAssetIndexCache
+{
+public:
+	// Constructor, builds the maps of the given asset
+	explicit PhysicsAssetIndexCache(const UPhysicsAsset* InPhysicsAsset);
+
+	// Destructor
+	~PhysicsAssetIndexCache();
+
+	// Get the shared cache of the physics asset, builds it on first use
+	static TSharedPtr<const PhysicsAssetIndexCache> Get(const UPhysicsAsset* PhysicsAsset);
+
+	// Index of the constraint with the given joint (child bone) name, INDEX_NONE if not found
+	FORCEINLINE int32 FindConstraintIndex(const FName JointName) const
+	{
+		const int32* Index = ConstraintIndexByJointName.Find(JointName);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	// Index of the body with the given bone name, INDEX_NONE if not found
+	FORCEINLINE int32 FindBodyIndex(const FName BoneName) const
+	{
+		const int32* Index = BodyIndexByBoneName.Find(BoneName);
+		return Index ? *Index : INDEX_NONE;
+	}
+
+	// Resolve a joint name, falls back to the joint of the other hand side (_l / _r) if the asset has only that one, NAME_None if neither exists
+	FName ResolveJointName(const FString& BoneName, bool& bOutOtherSide) const;
+
+	// Resolve a bone name, falls back to the bone of the other hand side (_l / _r) if the asset has only that one, NAME_None if neither exists
+	FName ResolveBoneName(const FString& BoneName, bool& bOutOtherSide) const;
+
+	// Name of the same bone of the other hand side (_l <-> _r), empty if the name has no side suffix
+	static FString GetOtherSideBoneName(const FString& BoneName);
+
+	// Check if the cache still matches the layout (names and order of the constraints and bodies) of the physics asset
+	bool IsUpToDate(const UPhysicsAsset* InPhysicsAsset) const;
+
+	// Hash of the joint and bone names of the asset in index order, changes if bodies or constraints are added, removed, renamed or reordered
+	static uint32 ComputeLayoutHash(const UPhysicsAsset* InPhysicsAsset);
+
+private:
+	// Joint name to constraint index
+	TMap<FName, int32> ConstraintIndexByJointName;
+
+	// Bone name to body index
+	TMap<FName, int32> BodyIndexByBoneName;
+
+	// Layout hash of the asset when the cache was built
+	uint32 LayoutHash;
+
+	// Caches of all used physics assets
+	static TMap<TWeakObjectPtr<const UPhysicsAsset>, TSharedPtr<const PhysicsAssetIndexCache>> Caches;
+};
@@ -0,0 +1,120 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#include "PosePredictor.h"
+
+// Constructor
+PosePredictor::PosePredictor() :
+	NumValidSamples(0)
+{
+}
+
+// Add the pose sampled at the given time
+void PosePredictor::AddSample(const FTransform& Pose, const float Time)
+{
+	// Samples without time difference can not be extrapolated, keep the newest one
+	if (NumValidSamples > 0 && Time <= Samples[0].Time)
+	{
+		Samples[0].Pose = Pose;
+		return;
+	}
+
+	for (int32 SampleIndex = NumSamples - 1; SampleIndex > 0; --SampleIndex)
+	{
+		Samples[SampleIndex] = Samples[SampleIndex - 1];
+	}
+	Samples[0].Pose = Pose;
+	Samples[0].Time = Time;
+	NumValidSamples = FMath::Min(NumValidSamples + 1, NumSamples);
+
+	EvaluatePredictions();
+}
+
+// Predict the pose the given time after the last sample
+FTransform PosePredictor::Predict(const float Horizon)
+{
+	if (NumValidSamples == 0)
+	{
+		return FTransform::Identity;
+	}
+
+	FTransform Predicted = Samples[0].Pose;
+	if (NumValidSamples < 2 || Horizon <= 0.0f)
+	{
+		return Predicted;
+	}
+
+	const FVector Loc0 = Samples[0].Pose.GetLocation();
+	const FVector Loc1 = Samples[1].Pose.GetLocation();
+	const float Dt0 = Samples[0].Time - Samples[1].Time;
+	const FVector Velocity = (Loc0 - Loc1) / Dt0;
+
+	// Acceleration from the last two velocities
+	FVector Acceleration = FVector::ZeroVector;
+	if (NumValidSamples > 2)
+	{
+		const float Dt1 = Samples[1].Time - Samples[2].Time;
+		const FVector PrevVelocity = (Loc1 - Samples[2].Pose.GetLocation()) / Dt1;
+		Acceleration = (Velocity - PrevVelocity) / (0.5f * (Dt0 + Dt1));
+	}
+	Predicted.SetLocation(Loc0 + Velocity * Horizon + 0.5f * Acceleration * Horizon * Horizon);
+
+	// Rotation continued with the last angular velocity
+	const FQuat Quat0 = Samples[0].Pose.GetRotation();
+	FQuat Quat1 = Samples[1].Pose.GetRotation();
+	// Avoid taking the long path around the sphere
+	if ((Quat0 | Quat1) < 0)
+	{
+		Quat1 *= -1.f;
+	}
+	FVector Axis;
+	float Angle;
+	(Quat0 * Quat1.Inverse()).ToAxisAndAngle(Axis, Angle);
+	Predicted.SetRotation(FQuat(Axis, Angle * Horizon / Dt0) * Quat0);
+
+	FPoseSample Prediction;
+	Prediction.Pose = Predicted;
+	Prediction.Time = Samples[0].Time + Horizon;
+	PendingPredictions.Add(Prediction);
+	return Predicted;
+}
+
+// Forget the samples and the error
+void PosePredictor::Reset()
+{
+	NumValidSamples = 0;
+	PendingPredictions.Reset();
+	Stats = FPosePredictionStats();
+}
+
+// Compare the pending predictions up to the newest sample
+void PosePredictor::EvaluatePredictions()
+{
+	if (NumValidSamples < 2) return;
+
+	const FPoseSample& Newest = Samples[0];
+	const FPoseSample& Previous = Samples[1];
+
+	int32 NumEvaluated = 0;
+	for (const FPoseSample& Prediction : PendingPredictions)
+	{
+		if (Prediction.Time > Newest.Time)
+			break;
+		++NumEvaluated;
+
+		// Actual pose at the predicted time, interpolated between the samples around it
+		const float Alpha = FMath::Clamp((Prediction.Time - Previous.Time) / (Newest.Time - Previous.Time), 0.0f, 1.0f);
+		const FVector ActualLocation = FMath::Lerp(Previous.Pose.GetLocation(), Newest.Pose.GetLocation(), Alpha);
+		const FQuat ActualRotation = FQuat::Slerp(Previous.Pose.GetRotation(), Newest.Pose.GetRotation(), Alpha);
+
+		const float LocationError = FVector::Dist(Prediction.Pose.GetLocation(), ActualLocation);
+		const float RotationError = FMath::RadiansToDegrees(Prediction.Pose.GetRotation().AngularDistance(ActualRotation));
+
+		// Running mean and maximum
+		++Stats.NumPredictions;
+		Stats.MeanLocationError += (LocationError - Stats.MeanLocationError) / Stats.NumPredictions;
+		Stats.MeanRotationError += (RotationError - Stats.MeanRotationError) / Stats.NumPredictions;
+		Stats.MaxLocationError = FMath::Max(Stats.MaxLocationError, LocationError);
+		Stats.MaxRotationError = FMath::Max(Stats.MaxRotationError, RotationError);
+	}
+	PendingPredictions.RemoveAt(0, NumEvaluated, false);
+}
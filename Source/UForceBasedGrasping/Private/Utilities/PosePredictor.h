@@ -0,0 +1,56 @@
+// Copyright 2017, Institute for Artificial Intelligence - University of Bremen
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Structs/PosePredictionStats.h"
+
+/**
+ * Extrapolates a pose a short time ahead from its last samples,
+ * with velocity and acceleration for the location and angular velocity for the rotation.
+ * Every prediction is compared to the pose sampled at its time, for the error readout.
+ */
+class UFORCEBASEDGRASPING_API PosePredictor
+{
+public:
+	// Constructor
+	PosePredictor();
+
+	// Add the pose sampled at the given time
+	void AddSample(const FTransform& Pose, const float Time);
+
+	// Predict the pose the given time after the last sample, and remember it for the error readout
+	FTransform Predict(const float Horizon);
+
+	// Error of the evaluated predictions
+	const FPosePredictionStats& GetStats() const { return Stats; }
+
+	// Forget the samples and the error
+	void Reset();
+
+private:
+	// A pose sample
+	struct FPoseSample
+	{
+		FTransform Pose;
+		float Time;
+	};
+
+	// Number of samples used for the extrapolation
+	static const int32 NumSamples = 3;
+
+	// Last samples, newest first
+	FPoseSample Samples[NumSamples];
+
+	// Number of valid samples
+	int32 NumValidSamples;
+
+	// Predictions not yet compared to a sample
+	TArray<FPoseSample> PendingPredictions;
+
+	// Error of the evaluated predictions
+	FPosePredictionStats Stats;
+
+	// Compare the pending predictions up to the newest sample
+	void EvaluatePredictions();
+};
@@ -7,11 +7,22 @@
 #include "Hand/Grasp.h"
 #include "Animation/SkeletalMeshActor.h"
 #include "Components/SphereComponent.h"
+#include "PhysicsEngine/PhysicsConstraintComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
 #include "Engine/StaticMeshActor.h"
 #include "Structs/Finger.h"
+#include "Structs/HandStateSnapshot.h"
+#include "Structs/TrackingGains.h"
+#include "Utilities/GraspableObjectRegistry.h"
+#include "Utilities/Mailbox.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "PIDController3D.h"
 
 #include "Hand.generated.h"
 
+class AHandProximityService;
+class AHandManager;
+
 /** Number of hands constants */
 enum
 {
@@ -47,6 +58,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MC|Hand")
 		EHandType HandType;
 
+	// Axis the right hand pose tables are mirrored along for a left hand skeleton (None = use them as they are)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand")
+		TEnumAsByte<EAxis::Type> PoseMirrorAxis;
+
 	// Thumb finger skeletal bone names
 	UPROPERTY(EditAnywhere, Category = "MC|Hand")
 		FFinger Thumb;
@@ -73,9 +88,68 @@ public:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
-	// Called every frame
+	// Called when the actor is removed from the world
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Called every frame (only if the hand is not updated by the hand manager)
 	virtual void Tick(float DeltaSeconds) override;
 
+	// Read the physics state of the hand (first update phase)
+	void ReadPhysicsState();
+
+	// Compute the hand controllers from the state read, only hand local data is written (second update phase, thread safe between hands)
+	void ComputeControl(const float DeltaTime);
+
+	// Apply the controller output to physics (third update phase)
+	void WritePhysicsState();
+
+	// Set the gains of the force based tracking of the hand
+	void SetTrackingController(const float PGain, const float IGain, const float DGain,
+		const float MaxOutput, const float InRotationBoost);
+
+	// Set the world pose the hand should be moved to
+	void SetTrackingTarget(const FTransform& InTarget);
+
+	// Stop moving the hand to the tracking target
+	void ClearTrackingTarget();
+
+	// Set the slot of the hand in the batched tracking controllers of the hand manager (INDEX_NONE = own controller)
+	void SetTrackingBatchSlot(const int32 Slot) { TrackingBatchSlot = Slot; };
+
+	// Slot of the hand in the batched tracking controllers of the hand manager
+	int32 GetTrackingBatchSlot() const { return TrackingBatchSlot; };
+
+	// The tracking is computed once per frame, its error is computed in the compute phase
+	bool HasFrameTracking() const { return bHasTrackingTarget && !bTrackingOnSubsteps; };
+
+	// Location error of the tracking of the current tick
+	const FVector& GetTrackingLocationError() const { return TrackingLocationError; };
+
+	// Rotation error of the tracking of the current tick (axis scaled by the sine of the half angle, by the angle in rad with the rotation PD)
+	const FVector& GetTrackingRotationError() const { return TrackingRotationError; };
+
+	// Gains of the tracking controller
+	void GetTrackingGains(float& OutPGain, float& OutDGain, float& OutMaxOutput, float& OutRotationBoost) const;
+
+	// The rotation is tracked with the PD controller outputting torque
+	bool IsRotationPDControl() const { return bRotationPDControl; };
+
+	// Gains of the rotation PD controller
+	void GetRotationPDGains(float& OutPGain, float& OutDGain, float& OutMaxAngularAcceleration) const;
+
+	// Set the tracking output computed by the batched controllers of the hand manager
+	// (angular velocity in deg/s, or angular acceleration in rad/s^2 with the rotation PD)
+	void SetTrackingOutput(const FVector& Force, const FVector& RotationOutput);
+
+	// The tracking is computed on every physics substep
+	bool HasSubstepTracking() const { return bHasTrackingTarget && bTrackingOnSubsteps; };
+
+	// Tracking errors and angular velocity (rad/s) of the root body of this substep, false if there is no target yet (physics substep)
+	bool ComputeSubstepTrackingError(FVector& OutLocationError, FVector& OutRotationError, FVector& OutAngularVelocity);
+
+	// Apply the tracking output computed by the batched controllers of the hand manager (physics substep)
+	void ApplySubstepTrackingOutput(const FVector& Force, const FVector& RotationOutput);
+
 	// Update the grasp //TODO state, power, step
 	void UpdateGrasp(const float Goal);
 
@@ -112,20 +186,66 @@ public:
 	// Get possible two hand grasp object
 	AStaticMeshActor* GetTwoHandsGraspableObject() const { return TwoHandsGraspableObject; };
 
+	// Get the object attached to this hand in a two hands grasp
+	AStaticMeshActor* GetTwoHandsGraspedObject() const { return TwoHandsGraspedObject; };
+
 	// Check if the two hand grasp is still valid (the hands have not moved away from each other)
 	bool IsTwoHandGraspStillValid();
 
 	// Set pointer to other hand, used for two hand fixation grasp
 	void SetOtherHand(AHand* InOtherHand);
 
+	// Get the sphere in which objects can be fixation grasped, false if the hand does not look for objects
+	bool GetFixationGraspReach(FSphere& OutSphere) const;
+
+	// Object came in grasping reach, check if it is one-, two-hand(s), or not graspable
+	void OnObjectInReach(AActor* OtherActor);
+
+	// Object out of grasping reach, remove as possible grasp object
+	void OnObjectLeftReach(AActor* OtherActor);
+
 	void ResetAngularDriveValues(EAngularDriveMode::Type DriveMode, EAngularDriveType DriveType);
 
 	UFUNCTION(BlueprintCallable)
 		float GetMaxAngularForceOfAllConstraints();
 
+	// Physics state of the hand read at the beginning of the current tick
+	UFUNCTION(BlueprintPure, Category = "MC|Hand State")
+		const FHandStateSnapshot& GetHandState() const { return HandState; };
+
 	UFUNCTION(BlueprintCallable)
 		float GetAngularForceOfConstraint(const FName & JointName);
 
+	// Resolve the handle of a constraint by its joint name, resolve once and query the force with the handle
+	UFUNCTION(BlueprintCallable, Category = "MC|Hand State")
+		FHandJointHandle GetJointHandle(const FName & JointName) const;
+
+	// Get the handle of the constraint of a finger part
+	UFUNCTION(BlueprintPure, Category = "MC|Hand State")
+		FHandJointHandle GetFingerJointHandle(EFingerType FingerType, EFingerPart FingerPart) const;
+
+	// Angular force of the constraint of the current tick
+	UFUNCTION(BlueprintPure, Category = "MC|Hand State")
+		float GetAngularForceOfJoint(const FHandJointHandle & JointHandle) const;
+
+	// Angular force of the finger part constraint of the current tick
+	UFUNCTION(BlueprintPure, Category = "MC|Hand State")
+		float GetAngularForceOfFingerPart(EFingerType FingerType, EFingerPart FingerPart) const;
+
+	// Angular forces of all constraints of the current tick, indexed by the joint handles
+	UFUNCTION(BlueprintPure, Category = "MC|Hand State")
+		const TArray<float>& GetAngularForcesOfAllJoints() const { return HandState.AngularForces; };
+
+	// Grip force of all finger joints of the current tick
+	UFUNCTION(BlueprintPure, Category = "MC|Hand State")
+		float GetGripForce() const;
+
+	// Time the tracking output was last written to physics (FPlatformTime::Cycles64)
+	uint64 GetLastTrackingCommitCycles() const { return static_cast<uint64>(LastTrackingCommitCycles.GetValue()); };
+
+	// Time the finger targets were last written to physics (FPlatformTime::Cycles64)
+	uint64 GetLastGraspCommitCycles() const { return GraspPtr.IsValid() ? GraspPtr->GetLastCommitCycles() : 0; };
+
 protected:
 	// Collision component used for attaching grasped objects
 	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"))
@@ -160,6 +280,10 @@ private:
 	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"))
 		USphereComponent* FixationGraspArea;
 
+	// Constraint tying the hand to the object grasped by the other hand
+	UPROPERTY(VisibleAnywhere, Category = "MC|Fixation Grasp")
+		UPhysicsConstraintComponent* TwoHandsGraspConstraint;
+
 	// Maximum mass (kg) of an object that can be attached to the hand
 	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"), meta = (ClampMin = 0))
 		float OneHandFixationMaximumMass;
@@ -177,10 +301,34 @@ private:
 	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"), meta = (ClampMin = 0))
 		float TwoHandsFixationMaximumLength;
 
+	// Maximum number of candidates scored for a one hand fixation grasp
+	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"), meta = (ClampMin = 1))
+		int32 MaxFixationGraspCandidates;
+
+	// Direction of the palm in the local space of the hand, used to score the approach of the candidates
+	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"))
+		FVector PalmDirection;
+
+	// Weight of the distance between the palm and the candidate
+	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"), meta = (ClampMin = 0))
+		float CandidateDistanceWeight;
+
+	// Weight of the alignment of the palm direction with the direction to the candidate
+	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"), meta = (ClampMin = 0))
+		float CandidateAlignmentWeight;
+
+	// Weight of the size of the candidate (smaller objects are preferred)
+	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"), meta = (ClampMin = 0))
+		float CandidateSizeWeight;
+
 	// Should the Force of the Grasps be logged.
 	UPROPERTY(EditAnywhere, Category = "MC|Drive Parameters")
 		bool bLogGrasp;
 
+	// Show the joint forces on screen every 0.2 s (debug, off by default)
+	UPROPERTY(EditAnywhere, Category = "MC|Drive Parameters")
+		bool bShowJointForces;
+
 	// Spring value to apply to the angular drive (Position strength)
 	UPROPERTY(EditAnywhere, Category = "MC|Drive Parameters", meta = (ClampMin = 0))
 		float Spring;
@@ -197,6 +345,57 @@ private:
 	UPROPERTY(EditAnywhere, Category = "MC|Drive Parameters", meta = (ClampMin = 0))
 		float VelocityThreshold;
 
+	// Move the hand to the tracking target on every physics substep instead of once per frame
+	UPROPERTY(EditAnywhere, Category = "MC|Hand")
+		bool bTrackingOnSubsteps;
+
+	// Drive only the root body to the tracking target, the fingers follow through their joints
+	// (the tracking force is scaled with the mass of the hand, otherwise it is applied as acceleration to every body)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand")
+		bool bTrackRootBodyOnly;
+
+	// Track the rotation with a PD controller on the angle error and the measured angular velocity, applied as torque
+	// scaled with the world inertia of the driven bodies (the root body includes its welded objects) (otherwise the angular velocity is set from the rotation error scaled by the rotation boost)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand")
+		bool bRotationPDControl;
+
+	// Proportional gain of the rotation PD controller (1/s^2)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand", meta = (editcondition = "bRotationPDControl", ClampMin = 0))
+		float RotationPGain;
+
+	// Derivative gain of the rotation PD controller, on the measured angular velocity (1/s)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand", meta = (editcondition = "bRotationPDControl", ClampMin = 0))
+		float RotationDGain;
+
+	// Maximum angular acceleration of the rotation PD controller (rad/s^2)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand", meta = (editcondition = "bRotationPDControl", ClampMin = 0))
+		float MaxAngularAcceleration;
+
+	// Switch the tracking gains with the mass moved by the hand (e.g. after attaching an object)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand")
+		bool bScheduleTrackingGains;
+
+	// Tracking gains by mass bucket, sorted by mass (generated from the gains of SetTrackingController if empty)
+	UPROPERTY(EditAnywhere, Category = "MC|Hand", meta = (editcondition = "bScheduleTrackingGains"))
+		TArray<FTrackingGains> TrackingGainSchedule;
+
+	// Run the grasp controller with a fixed timestep (frame rate independent)
+	UPROPERTY(EditAnywhere, Category = "MC|Grasp Control")
+		bool bFixedTimestepGrasp;
+
+	// Step the grasp controller in the physics substeps with the substep time, otherwise once per frame
+	// in the compute phase (which can run in parallel for several hands) and apply it in the write phase
+	UPROPERTY(EditAnywhere, Category = "MC|Grasp Control", meta = (editcondition = "bFixedTimestepGrasp"))
+		bool bGraspControlOnSubsteps;
+
+	// Fixed timestep (s) of the grasp controller
+	UPROPERTY(EditAnywhere, Category = "MC|Grasp Control", meta = (editcondition = "bFixedTimestepGrasp"), meta = (ClampMin = 0.001))
+		float GraspControlTimestep;
+
+	// Maximum change of the grasp value per second (0 = no limit)
+	UPROPERTY(EditAnywhere, Category = "MC|Grasp Control", meta = (editcondition = "bFixedTimestepGrasp"), meta = (ClampMin = 0))
+		float MaxGraspAlphaRate;
+
 	// Enable grasping with fixation
 	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp")
 		bool bFixationGraspEnabled;
@@ -205,18 +404,83 @@ private:
 	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"))
 		bool bTwoHandsFixationGraspEnabled;
 
+	// Find the objects in reach with the shared proximity service instead of overlap events
+	UPROPERTY(EditAnywhere, Category = "MC|Fixation Grasp", meta = (editcondition = "bEnableFixationGrasp"))
+		bool bUseProximityService;
+
+	// Promote a stable force grasp to a fixation grasp, demote it back to physics when the grasp is released
+	UPROPERTY(EditAnywhere, Category = "MC|Hybrid Grasp")
+		bool bHybridGraspEnabled;
+
+	// Minimum grip force (sum of the angular forces of the finger joints) of a stable grasp
+	UPROPERTY(EditAnywhere, Category = "MC|Hybrid Grasp", meta = (editcondition = "bHybridGraspEnabled"), meta = (ClampMin = 0))
+		float HybridPromoteGripForce;
+
+	// Maximum speed (cm/s) of the object relative to the hand in a stable grasp
+	UPROPERTY(EditAnywhere, Category = "MC|Hybrid Grasp", meta = (editcondition = "bHybridGraspEnabled"), meta = (ClampMin = 0))
+		float HybridMaxRelativeSpeed;
+
+	// Maximum distance (cm) of the fingertip bones to the object, the thumb and one finger have to touch it to promote the grasp
+	UPROPERTY(EditAnywhere, Category = "MC|Hybrid Grasp", meta = (editcondition = "bHybridGraspEnabled"), meta = (ClampMin = 0))
+		float HybridContactDistance;
+
+	// Time (s) the grasp has to be stable before it is promoted
+	UPROPERTY(EditAnywhere, Category = "MC|Hybrid Grasp", meta = (editcondition = "bHybridGraspEnabled"), meta = (ClampMin = 0))
+		float HybridPromoteTime;
+
+	// Grasp value below which the promoted grasp is demoted back to physics
+	UPROPERTY(EditAnywhere, Category = "MC|Hybrid Grasp", meta = (editcondition = "bHybridGraspEnabled"), meta = (ClampMin = 0, ClampMax = 1))
+		float HybridDemoteGraspAlpha;
+
+	// Update the hand with all other hands in the tick of the hand manager instead of its own tick
+	UPROPERTY(EditAnywhere, Category = "MC|Hand")
+		bool bUseHandManager;
+
 	// Check if object is graspable, return the number of hands (0, 1, 2)
 	uint8 CheckObjectGraspableType(AActor* InActor);
 
+	// Mass and length limits of the fixation grasp
+	FGraspabilityLimits GetGraspabilityLimits() const;
+
+	// Enable or disable looking for objects in the fixation grasp area
+	void SetFixationGraspAreaEnabled(const bool bEnabled);
+
+	// Get the best scored one hand graspable object, nullptr if there is none (the object stays a candidate)
+	AStaticMeshActor* GetBestOneHandFixationGraspCandidate() const;
+
 	// Hold grasp in the current position
 	void MaintainFingerPositions();
 
+	// Disable physics on the object and attach it to the hand
+	bool AttachOneHandFixationGraspObject(AStaticMeshActor* InObject);
+
+	// Check the stability of the force grasp and decide on promotion or demotion (compute phase)
+	void UpdateHybridGrasp(const float DeltaTime);
+
+	// Turn the stable force grasp into a fixation grasp (write phase)
+	void PromoteHybridGrasp();
+
+	// Check if the thumb and at least one finger touch the object (read phase)
+	bool IsHeldByFingertips(AStaticMeshActor* InObject) const;
+
+	// Freeze the fingers in their pose (damping only) or drive them to the grasp targets again
+	void SetFingerDrivesFrozen(const bool bFrozen);
+
 	// Setup hand default values
 	void SetupHandDefaultValues(EHandType HandType);
 
 	// Setup skeletal mesh default values
 	void SetupSkeletalDefaultValues(USkeletalMeshComponent* InSkeletalMeshComponent);
 
+	// Map the skeletal constraints to the joints of the hand state
+	void SetupHandStateJointIndices();
+
+	// Mirror the right hand pose tables if the skeleton is a left hand
+	void SetupPoseMirroring();
+
+	// Read the physics state of the hand in a single pass
+	void UpdateHandState();
+
 	//	// Callback on collision
 	//	UFUNCTION()
 	//	void OnFingerHit(UPrimitiveComponent* SelfComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
@@ -241,17 +505,167 @@ private:
 	// Pointer to the other hand (used for two hand fixation grasp)
 	AHand* OtherHand;
 
-	// If the hand is mimicking movements in the two hand fixation grasp case (no actual attachment)
-	bool bMovementMimickingHand;
+	// Service reporting the objects in reach
+	TWeakObjectPtr<AHandProximityService> ProximityService;
+
+	// Manager updating the hand
+	TWeakObjectPtr<AHandManager> HandManager;
+
+	// Manager computing the substep tracking of the upcoming substeps, validated on the game thread every tick
+	AHandManager* SubstepTrackingManager;
+
+	// Controller of the force based tracking of the hand
+	PIDController3D TrackingPIDController;
+
+	// Hand rotation tracking boost
+	float TrackingRotationBoost;
+
+	// Gains of the tracking controller, for the batched controllers
+	float TrackingPGain;
+	float TrackingDGain;
+	float TrackingMaxOutput;
+
+	// Slot in the batched tracking controllers of the hand manager (INDEX_NONE = own controller)
+	int32 TrackingBatchSlot;
+
+	// Tracking errors computed for the current tick
+	FVector TrackingLocationError;
+	FVector TrackingRotationError;
+
+	// World pose the hand is moved to
+	FTransform TrackingTarget;
+
+	// The hand is moved to the tracking target
+	bool bHasTrackingTarget;
+
+	// Latest tracking target written by the game thread, read by the physics substep
+	TMailbox<FTransform> TrackingTargetMailbox;
+
+	// Tracking target used by the physics substeps
+	FTransform SubstepTrackingTarget;
+
+	// Transform of the component relative to its root body
+	FTransform RootBodyToComponent;
+
+	// Tracking force computed for the current tick (acceleration of the hand)
+	FVector TrackingForce;
+
+	// Mass of the finger bodies, constant over the play
+	float FingersMass;
+
+	// Mass moved by the tracking (fingers, root body and welded objects), updated in the read phase
+	float TrackingMass;
 
-	// Movement mimicking relative location from the other hand
-	FVector MimickingRelativeLocation;
+	// Mass of the hand without objects
+	float BareHandMass;
 
-	// Movement mimicking relative rotation from the other hand
-	FQuat MimickingRelativeRotation;
+	// Gains set with SetTrackingController, tuned for the bare hand
+	FTrackingGains BaseTrackingGains;
+
+	// Gain schedule in use, sorted by mass
+	TArray<FTrackingGains> ActiveGainSchedule;
+
+	// The gain schedule has to be rebuilt
+	bool bGainScheduleDirty;
+
+	// Mass of the last gain bucket selection
+	float ScheduledMass;
+
+	// Index of the gain bucket in use
+	int32 TrackingGainBucket;
+
+	// Tracking angular velocity (deg/s) or angular acceleration (rad/s^2, rotation PD) computed for the current tick
+	FVector TrackingAngularVelocity;
+
+	// Time the tracking output was last written to physics, written by the substep
+	FThreadSafeCounter64 LastTrackingCommitCycles;
+
+	// Show the joint forces in the write phase of the current tick
+	bool bShowJointForcesPending;
+
+	// Last value of the grasp input
+	float GraspInputAlpha;
+
+	// Object held by the force grasp, checked for promotion
+	AStaticMeshActor* HybridCandidate;
+
+	// Speed of the candidate relative to the hand (cm/s)
+	float HybridCandidateRelativeSpeed;
+
+	// The fingers touch the candidate
+	bool bHybridCandidateTouched;
+
+	// Time the force grasp of the candidate has been stable
+	float HybridStableTime;
+
+	// The current one hand fixation grasp is a promoted force grasp
+	bool bHybridGraspPromoted;
+
+	// Promote the force grasp in the write phase of the current tick
+	bool bHybridPromotePending;
+
+	// Demote the promoted grasp in the write phase of the current tick
+	bool bHybridDemotePending;
+
+	// Collision of the object before the promotion, restored on demotion
+	TEnumAsByte<ECollisionEnabled::Type> HybridObjectCollision;
+
+	// The hand is looking for objects to grasp
+	bool bFixationGraspAreaEnabled;
+
+	// If the hand is tied with the constraint to the object of the other hand in the two hand fixation grasp case (no actual attachment)
+	bool bTwoHandsConstrained;
 
 	// Mark that the grasp has been held, avoid reinitializing the finger drivers
 	bool bGraspHeld;
+
+	// Physics state of the hand of the current tick
+	FHandStateSnapshot HandState;
+
+	// Joint index in the hand state of each skeletal constraint (INDEX_NONE if not a finger joint)
+	TArray<int32> ConstraintToJointIndex;
+
+	// Skeletal constraint index of each joint of the hand state (INDEX_NONE if the joint does not exist)
+	TArray<int32> JointToConstraintIndex;
+
+	// Constraint and body indices of the physics asset
+	TSharedPtr<const PhysicsAssetIndexCache> IndexCache;
+
+	// Physics substep callback, re-registered every tick
+	FCalculateCustomPhysics OnCalculateCustomPhysics;
+
+	// Called on every physics substep
+	void SubstepTick(float DeltaTime, FBodyInstance* BodyInstance);
+
+	// Move the hand to the latest tracking target, called on every physics substep
+	void UpdateTrackingSubstep(const float DeltaTime, FBodyInstance* RootBody);
+
+	// Build the gain schedule out of the configured table or out of the base gains
+	void SetupTrackingGainSchedule();
+
+	// Select the gain bucket of the moved mass, only if the mass changed (read phase)
+	void UpdateTrackingGainSchedule();
+
+	// Set the gains of the tracking controllers
+	void ApplyTrackingGains(const FTrackingGains& Gains);
+
+	// Location error and rotation error (xyz of the shortest rotation, or its axis scaled by the angle) of the current pose to the target pose
+	static void ComputeTrackingError(const FTransform& Target, const FTransform& Current,
+		FVector& OutLocationError, FVector& OutRotationError, const bool bAngleAxisError = false);
+
+	// Torque giving the body the angular acceleration (rad/s^2), uses the world inertia tensor of the body
+	// (bAssumesLocked in the physics substep, where the scene is already locked)
+	static FVector AngularAccelerationToTorque(const FBodyInstance* Body, const FVector& AngularAcceleration, const bool bAssumesLocked);
+
+	// PD angular acceleration (rad/s^2) from the rotation error (axis scaled by the angle) and the angular velocity (rad/s)
+	FVector ComputeRotationPD(const FVector& RotationError, const FVector& AngularVelocity) const;
+
+	// PD force and angular velocity (deg/s) or angular acceleration (rad/s^2, rotation PD) moving the current pose to the target pose
+	void ComputeTrackingOutput(const FTransform& Target, const FTransform& Current, const FVector& CurrentAngularVelocity,
+		const float DeltaTime, FVector& OutForce, FVector& OutRotationOutput);
+
+	// Apply the tracking output to the root body or to all bodies of the hand
+	void ApplyTrackingOutput(const FVector& Force, const FVector& RotationOutput, const bool bInSubstep);
 	
 	// Setup fingers angular drive values
 	FORCEINLINE void SetupAngularDriveValues(EAngularDriveMode::Type DriveMode, EAngularDriveType DriveType);
@@ -10,6 +10,9 @@
 #include "MotionControllerComponent.h"
 #include "PIDController3D.h"
 #include "Hand.h"
+#include "Utilities/PosePredictor.h"
+#include "Utilities/MCInputRecording.h"
+#include "Utilities/HandLatencyStats.h"
 #include "Widgets/GraspTypeWidget/GraspTypeWidget.h"
 #include "WidgetInteractionComponent.h"
 
@@ -27,6 +30,9 @@ public:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	// Called when the character is removed from the world
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 
@@ -45,6 +51,18 @@ public:
 	//Toggle the User Interface
 	void ToggleUserInterface();
 
+	// The replay of the input recording passed its last frame
+	UFUNCTION(BlueprintPure, Category = "MC|Input Recording")
+		bool IsInputReplayFinished() const { return bReplayInput && InputRecording.IsReplayFinished(); };
+
+	// Error of the left motion controller pose prediction
+	UFUNCTION(BlueprintPure, Category = "MC|Control")
+		FPosePredictionStats GetLeftPredictionError() const { return LeftPosePredictor.GetStats(); };
+
+	// Error of the right motion controller pose prediction
+	UFUNCTION(BlueprintPure, Category = "MC|Control")
+		FPosePredictionStats GetRightPredictionError() const { return RightPosePredictor.GetStats(); };
+
 protected:
 	// Left hand skeletal mesh
 	UPROPERTY(EditAnywhere, Category = "MC|Hands")
@@ -90,6 +108,62 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "MC|Control")
 		float RotationBoost;
 
+	// Drive only the root body of the hands without AHand, with the force scaled by the hand mass
+	UPROPERTY(EditAnywhere, Category = "MC|Control")
+		bool bTrackRootBodyOnly;
+
+	// Move the hands to the motion controller pose predicted at the end of the physics step, instead of the sampled one (off by default)
+	UPROPERTY(EditAnywhere, Category = "MC|Control")
+		bool bPredictMotionControllerPose;
+
+	// How far ahead to predict the motion controller pose (real time s), about the time until physics reaches the target
+	UPROPERTY(EditAnywhere, Category = "MC|Control", meta = (editcondition = "bPredictMotionControllerPose"), meta = (ClampMin = 0))
+		float PredictionHorizon;
+
+	// Print the prediction error on screen
+	UPROPERTY(EditAnywhere, Category = "MC|Control", meta = (editcondition = "bPredictMotionControllerPose"))
+		bool bShowPredictionError;
+
+	// Record the motion controller poses, grasp axes and actions, written to the recording file at the end of play
+	UPROPERTY(EditAnywhere, Category = "MC|Input Recording")
+		bool bRecordInput;
+
+	// Replay the recording file instead of the user input (no HMD needed)
+	UPROPERTY(EditAnywhere, Category = "MC|Input Recording")
+		bool bReplayInput;
+
+	// Recording file, relative to the saved directory of the project
+	UPROPERTY(EditAnywhere, Category = "MC|Input Recording")
+		FString InputRecordingFile;
+
+	// Fixed timestep of the engine during the replay (s)
+	UPROPERTY(EditAnywhere, Category = "MC|Input Recording", meta = (editcondition = "bReplayInput"), meta = (ClampMin = 0.001))
+		float ReplayTimestep;
+
+	// Measure the latency from the input to the hand response ("stat HandLatency", written to the log at the end of play)
+	UPROPERTY(EditAnywhere, Category = "MC|Latency")
+		bool bMeasureLatency;
+
+	// Motion controller movement that starts a pose latency measurement (cm)
+	UPROPERTY(EditAnywhere, Category = "MC|Latency", meta = (editcondition = "bMeasureLatency"), meta = (ClampMin = 0))
+		float LatencyPoseDistance;
+
+	// Distance to the pose target at which the hand has reached it (cm)
+	UPROPERTY(EditAnywhere, Category = "MC|Latency", meta = (editcondition = "bMeasureLatency"), meta = (ClampMin = 0))
+		float LatencyPoseTolerance;
+
+	// Grasp axis value of a trigger press
+	UPROPERTY(EditAnywhere, Category = "MC|Latency", meta = (editcondition = "bMeasureLatency"), meta = (ClampMin = 0, ClampMax = 1))
+		float LatencyTriggerThreshold;
+
+	// Grip force of the fingers at which they are in contact
+	UPROPERTY(EditAnywhere, Category = "MC|Latency", meta = (editcondition = "bMeasureLatency"), meta = (ClampMin = 0))
+		float LatencyContactGripForce;
+
+	// Measurements not finished after this time are dropped (s)
+	UPROPERTY(EditAnywhere, Category = "MC|Latency", meta = (editcondition = "bMeasureLatency"), meta = (ClampMin = 0))
+		float LatencyProbeTimeout;
+
 	// Character camera
 	UPROPERTY(EditAnywhere)
 		UCameraComponent* CharCamera;
@@ -112,11 +186,17 @@ protected:
 	// Move hands when not in VR up and down
 	void MoveHandsOnZ(const float Value);
 
-	// Update hand positions
-	FORCEINLINE void UpdateHandLocationAndRotation(
+	// Get the hand target of the motion controller, predicted if enabled
+	FTransform GetHandTarget(
 		UMotionControllerComponent* MC,
 		const FQuat& RotOffset,
+		PosePredictor& Predictor);
+
+	// Update hand positions
+	FORCEINLINE void UpdateHandLocationAndRotation(
+		const FTransform& Target,
 		USkeletalMeshComponent* SkelMesh,
+		const float HandMass,
 		PIDController3D& PIDController,
 		const float DeltaTime);
 
@@ -124,6 +204,24 @@ protected:
 	// For testing several grasping processes
 	void SwitchGraspProcess();
 
+	// Update the latency measurements of the hand with the tracking target of this tick
+	void UpdateLatencyProbe(FHandLatencyProbe& Probe, const AHand* const Hand, const FVector& TargetLocation);
+
+	// Start or stop the trigger latency measurement with the grasp input
+	void UpdateTriggerLatencyProbe(FHandLatencyProbe& Probe, const float GraspAxis);
+
+	// Add the action to the frame being recorded
+	void RecordInputAction(const EMCInputAction Action, const uint8 Argument = 0);
+
+	// Record the input of this frame
+	void RecordInputFrame();
+
+	// Apply the input of the replay for this frame
+	void ReplayInputFrame();
+
+	// Trigger a recorded action
+	void ReplayInputAction(const FMCInputActionEvent& Event);
+
 	// Update left hand grasp
 	void GraspWithLeftHand(const float Val);
 
@@ -163,12 +261,24 @@ protected:
 	// Right hand controller
 	PIDController3D RightPIDController;
 
+	// Left motion controller pose prediction
+	PosePredictor LeftPosePredictor;
+
+	// Right motion controller pose prediction
+	PosePredictor RightPosePredictor;
+
 	// Left MC hand // TODO look into delegates to avoid dynamic casting
 	AHand* LeftHand;
 
 	// Right MC hand
 	AHand* RightHand;
 
+	// Mass of the left hand without AHand, for the root body tracking
+	float LeftHandMass;
+
+	// Mass of the right hand without AHand, for the root body tracking
+	float RightHandMass;
+
 	// Offset to add to the hand in order to tracked in the selected position (world rotation at start time)
 	FQuat LeftHandRotationOffset;
 
@@ -183,4 +293,20 @@ protected:
 
 	//Simulates mouse click for Widget
 	void SimulateMouseClick();
+
+	// Latency measurements of the left hand
+	FHandLatencyProbe LeftLatencyProbe;
+
+	// Latency measurements of the right hand
+	FHandLatencyProbe RightLatencyProbe;
+
+	// Recorded or replayed input
+	MCInputRecording InputRecording;
+
+	// Input of the frame being recorded
+	FMCInputFrame RecordedFrame;
+
+	// Fixed timestep settings of the engine before the replay
+	bool bPrevUseFixedTimeStep;
+	double PrevFixedDeltaTime;
 };